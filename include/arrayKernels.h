@@ -0,0 +1,182 @@
+#pragma once
+
+/**
+ * @file arrayKernels.h
+ * @brief Branch-free scan kernels over raw attribute arrays, split into parallel chunks.
+ *
+ * Each kernel works on a half-open element range [begin, end) of a flat array so that it
+ * can be handed to parallelCount() directly. The loop bodies avoid branches and library
+ * calls other than std::fabs so the compiler can auto-vectorize them for the target ISA.
+ */
+
+#include <pxr/base/work/reduce.h>
+
+#include <bitset>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace arrayKernels {
+
+/// Number of elements handled by one parallel task; smaller arrays are scanned inline.
+constexpr size_t kGrainSize = 1 << 16;
+
+/**
+ * @brief Sums a kernel over [0, n), splitting the range across worker threads.
+ * @param n Number of elements in the array being scanned.
+ * @param kernel Callable taking (begin, end) and returning the partial sum for that range.
+ * @return The total over the whole range.
+ */
+template <typename T, typename Kernel>
+T parallelSum(size_t n, const Kernel& kernel) {
+    if (n < kGrainSize) {
+        return kernel(size_t(0), n);
+    }
+    return pxr::WorkParallelReduceN(
+        T(0), n,
+        [&kernel](size_t begin, size_t end, const T& identity) {
+            return identity + kernel(begin, end);
+        },
+        [](const T& a, const T& b) { return a + b; },
+        kGrainSize);
+}
+
+/**
+ * @brief Sums a counting kernel over [0, n), splitting the range across worker threads.
+ */
+template <typename Kernel>
+size_t parallelCount(size_t n, const Kernel& kernel) {
+    return parallelSum<size_t>(n, kernel);
+}
+
+/**
+ * @brief Sums the values in [begin, end) as 64-bit integers.
+ */
+template <typename Value>
+int64_t sumValues(const Value* values, size_t begin, size_t end) {
+    int64_t sum = 0;
+    for (size_t i = begin; i < end; ++i) {
+        sum += static_cast<int64_t>(values[i]);
+    }
+    return sum;
+}
+
+/**
+ * @brief Counts vec3 elements whose squared length deviates from 1 by more than the tolerance.
+ *
+ * Non-finite vectors always count as deviating.
+ */
+inline size_t countNonUnitVec3(const float* xyz, size_t begin, size_t end, float tolerance) {
+    size_t bad = 0;
+    for (size_t i = begin; i < end; ++i) {
+        const float x = xyz[3 * i];
+        const float y = xyz[3 * i + 1];
+        const float z = xyz[3 * i + 2];
+        const float deviation = x * x + y * y + z * z - 1.0f;
+        bad += !(std::fabs(deviation) <= tolerance);
+    }
+    return bad;
+}
+
+/**
+ * @brief Counts N-component float tuples with at least one NaN or infinite component.
+ *
+ * Use N = 1 for scalar arrays, N = 3 for vec3 arrays and N = 4 for quaternion arrays.
+ */
+template <size_t N>
+size_t countNonFiniteTuples(const float* values, size_t begin, size_t end) {
+    size_t bad = 0;
+    for (size_t i = begin; i < end; ++i) {
+        // x - x is 0 for finite x and NaN otherwise, and NaN propagates through the sum
+        float sum = 0.0f;
+        for (size_t c = 0; c < N; ++c) {
+            sum += values[N * i + c] - values[N * i + c];
+        }
+        bad += !(sum == 0.0f);
+    }
+    return bad;
+}
+
+/**
+ * @brief Counts N-component half-float tuples with at least one NaN or infinite component.
+ *
+ * Halves are inspected as raw bits: an all-ones exponent marks infinity or NaN.
+ */
+template <size_t N>
+size_t countNonFiniteHalfTuples(const uint16_t* bits, size_t begin, size_t end) {
+    constexpr uint16_t kExponentMask = 0x7C00;
+    size_t bad = 0;
+    for (size_t i = begin; i < end; ++i) {
+        bool nonFinite = false;
+        for (size_t c = 0; c < N; ++c) {
+            nonFinite |= (bits[N * i + c] & kExponentMask) == kExponentMask;
+        }
+        bad += nonFinite;
+    }
+    return bad;
+}
+
+/**
+ * @brief Counts indices that fall outside [0, count).
+ *
+ * Negative values wrap to large unsigned values, so a single unsigned compare covers both ends.
+ */
+template <typename Index>
+size_t countOutOfRange(const Index* indices, size_t begin, size_t end, size_t count) {
+    using Unsigned = std::make_unsigned_t<Index>;
+    size_t bad = 0;
+    for (size_t i = begin; i < end; ++i) {
+        bad += static_cast<uint64_t>(static_cast<Unsigned>(indices[i])) >= static_cast<uint64_t>(count);
+    }
+    return bad;
+}
+
+/**
+ * @brief Counts N-component tuples with at least one component outside [low, high].
+ *
+ * NaN components fail both comparisons, so they always count as outside the range.
+ */
+template <size_t N, typename T>
+size_t countOutsideRange(const T* values, size_t begin, size_t end, T low, T high) {
+    size_t bad = 0;
+    for (size_t i = begin; i < end; ++i) {
+        bool outside = false;
+        for (size_t c = 0; c < N; ++c) {
+            const T value = values[N * i + c];
+            outside |= !((value >= low) & (value <= high));
+        }
+        bad += outside;
+    }
+    return bad;
+}
+
+/**
+ * @brief Sets the bit for every index in [0, size) in a packed bitset of at least size bits.
+ *
+ * Out of range indices are skipped, so they can be counted separately with countOutOfRange().
+ */
+template <typename Index>
+void setIndexBits(std::vector<uint64_t>& words, const Index* indices, size_t count, size_t size) {
+    using Unsigned = std::make_unsigned_t<Index>;
+    for (size_t i = 0; i < count; ++i) {
+        const uint64_t index = static_cast<Unsigned>(indices[i]);
+        if (index < size) {
+            words[index >> 6] |= uint64_t(1) << (index & 63);
+        }
+    }
+}
+
+/**
+ * @brief Counts the set bits of a packed bitset a whole word at a time.
+ */
+inline size_t countSetBits(const std::vector<uint64_t>& words) {
+    size_t bits = 0;
+    for (uint64_t word : words) {
+        bits += std::bitset<64>(word).count();
+    }
+    return bits;
+}
+
+} // namespace arrayKernels
@@ -0,0 +1,319 @@
+#pragma once
+
+/**
+ * @file imageHeader.h
+ * @brief Reads format, dimensions and pixel layout from image file headers without decoding pixels.
+ *
+ * Supported formats are identified by their magic bytes: PNG, JPEG, OpenEXR, TIFF, BMP and
+ * Radiance HDR. TGA has no magic number and is only recognized by its file extension.
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+/**
+ * @struct ImageHeader
+ * @brief Image properties read from a file header.
+ *
+ * @var format
+ * Short format name ("png", "jpeg", "exr", "tiff", "bmp", "hdr", "tga"), empty if unrecognized.
+ *
+ * @var bitsPerChannel
+ * Bits per channel of the in-memory representation (e.g. 16 for half-float EXR channels).
+ */
+struct ImageHeader {
+    std::string format;
+    uint32_t width = 0;
+    uint32_t height = 0;
+    uint32_t channels = 0;
+    uint32_t bitsPerChannel = 0;
+
+    // Returns true if the header was recognized and describes a non-empty image
+    bool isValid() const {
+        return !format.empty() && width > 0 && height > 0 && channels > 0 && bitsPerChannel > 0;
+    }
+
+    // Returns the uncompressed size of the top mip level in bytes
+    uint64_t byteSize() const {
+        return static_cast<uint64_t>(width) * height * channels * bitsPerChannel / 8;
+    }
+
+    // Returns the uncompressed size of the full mip chain in bytes, halving each level down to 1x1
+    uint64_t mipChainByteSize() const {
+        if (width == 0 || height == 0) {
+            return 0;
+        }
+        uint64_t texels = 0;
+        for (uint64_t w = width, h = height;; w = std::max<uint64_t>(1, w / 2), h = std::max<uint64_t>(1, h / 2)) {
+            texels += w * h;
+            if (w == 1 && h == 1) {
+                break;
+            }
+        }
+        return texels * channels * bitsPerChannel / 8;
+    }
+};
+
+namespace imageHeader {
+
+/// Bytes read up front; enough for every supported header except JPEG, EXR and TIFF, which read further.
+constexpr size_t kPrefixBytes = 512;
+
+/// Upper bound on the OpenEXR header size that will be scanned for attributes.
+constexpr size_t kExrHeaderBytes = 1 << 16;
+
+inline uint32_t readBE16(const unsigned char* p) { return (uint32_t(p[0]) << 8) | p[1]; }
+inline uint32_t readLE16(const unsigned char* p) { return uint32_t(p[0]) | (uint32_t(p[1]) << 8); }
+inline uint32_t readBE32(const unsigned char* p) { return (readBE16(p) << 16) | readBE16(p + 2); }
+inline uint32_t readLE32(const unsigned char* p) { return readLE16(p) | (readLE16(p + 2) << 16); }
+
+/**
+ * @brief Returns the lower-cased extension of a path without the dot, or an empty string.
+ */
+inline std::string extensionOf(const std::string& path) {
+    const size_t dot = path.find_last_of('.');
+    const size_t slash = path.find_last_of("/\\");
+    if (dot == std::string::npos || (slash != std::string::npos && dot < slash)) {
+        return "";
+    }
+    std::string extension = path.substr(dot + 1);
+    std::transform(extension.begin(), extension.end(), extension.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return extension;
+}
+
+/**
+ * @brief Returns the format name a file extension is expected to hold, or an empty string.
+ */
+inline std::string formatForExtension(const std::string& extension) {
+    if (extension == "png") return "png";
+    if (extension == "jpg" || extension == "jpeg") return "jpeg";
+    if (extension == "exr") return "exr";
+    if (extension == "tif" || extension == "tiff") return "tiff";
+    if (extension == "bmp") return "bmp";
+    if (extension == "hdr") return "hdr";
+    if (extension == "tga") return "tga";
+    return "";
+}
+
+inline void parsePng(const unsigned char* data, size_t size, ImageHeader& header) {
+    // Signature, then the IHDR chunk: length, "IHDR", width, height, bit depth, color type
+    if (size < 26 || std::memcmp(data + 12, "IHDR", 4) != 0) {
+        return;
+    }
+    static const uint32_t kChannelsByColorType[] = {1, 0, 3, 3, 2, 0, 4};
+    const unsigned colorType = data[25];
+    header.format = "png";
+    header.width = readBE32(data + 16);
+    header.height = readBE32(data + 20);
+    header.bitsPerChannel = colorType == 3 ? 8 : data[24];  // Palettes expand to 8-bit RGB
+    header.channels = colorType <= 6 ? kChannelsByColorType[colorType] : 0;
+}
+
+inline void parseJpeg(std::ifstream& file, ImageHeader& header) {
+    // Walk the marker segments until a start-of-frame marker carrying the dimensions
+    file.seekg(2);
+    unsigned char marker[4];
+    while (file.read(reinterpret_cast<char*>(marker), 4)) {
+        if (marker[0] != 0xFF) {
+            return;
+        }
+        const unsigned type = marker[1];
+        const uint32_t length = readBE16(marker + 2);
+        const bool startOfFrame = type >= 0xC0 && type <= 0xCF && type != 0xC4 && type != 0xC8 && type != 0xCC;
+        if (startOfFrame) {
+            unsigned char frame[6];
+            if (!file.read(reinterpret_cast<char*>(frame), 6)) {
+                return;
+            }
+            header.format = "jpeg";
+            header.bitsPerChannel = frame[0];
+            header.height = readBE16(frame + 1);
+            header.width = readBE16(frame + 3);
+            header.channels = frame[5];
+            return;
+        }
+        if (length < 2) {
+            return;
+        }
+        file.seekg(length - 2, std::ios::cur);
+    }
+}
+
+inline void parseExr(std::ifstream& file, ImageHeader& header) {
+    // Header attributes follow the magic number and version: name\0 type\0 int32 size, value
+    file.seekg(8);
+    std::vector<char> contents(kExrHeaderBytes);
+    file.read(contents.data(), static_cast<std::streamsize>(contents.size()));
+    contents.resize(static_cast<size_t>(file.gcount()));
+    const unsigned char* data = reinterpret_cast<const unsigned char*>(contents.data());
+    const size_t size = contents.size();
+    size_t pos = 0;
+    uint32_t maxChannelBits = 0;
+
+    auto readString = [&](std::string& out) {
+        const size_t start = pos;
+        while (pos < size && data[pos] != 0) ++pos;
+        if (pos >= size) return false;
+        out.assign(contents.data() + start, pos - start);
+        ++pos;
+        return true;
+    };
+
+    std::string name, type;
+    while (pos < size && data[pos] != 0) {
+        if (!readString(name) || !readString(type) || pos + 4 > size) {
+            return;
+        }
+        const uint32_t attributeSize = readLE32(data + pos);
+        pos += 4;
+        if (pos + attributeSize > size) {
+            return;
+        }
+        const unsigned char* value = data + pos;
+
+        if (name == "dataWindow" && type == "box2i" && attributeSize >= 16) {
+            const int32_t xMin = static_cast<int32_t>(readLE32(value));
+            const int32_t yMin = static_cast<int32_t>(readLE32(value + 4));
+            const int32_t xMax = static_cast<int32_t>(readLE32(value + 8));
+            const int32_t yMax = static_cast<int32_t>(readLE32(value + 12));
+            header.width = xMax >= xMin ? static_cast<uint32_t>(xMax - xMin + 1) : 0;
+            header.height = yMax >= yMin ? static_cast<uint32_t>(yMax - yMin + 1) : 0;
+        } else if (name == "channels" && type == "chlist") {
+            // Each channel: name\0, int32 pixel type (0 uint, 1 half, 2 float), 12 more bytes
+            size_t channelPos = 0;
+            while (channelPos < attributeSize && value[channelPos] != 0) {
+                while (channelPos < attributeSize && value[channelPos] != 0) ++channelPos;
+                if (channelPos + 17 > attributeSize) break;
+                const uint32_t pixelType = readLE32(value + channelPos + 1);
+                maxChannelBits = std::max(maxChannelBits, pixelType == 1 ? 16u : 32u);
+                ++header.channels;
+                channelPos += 17;
+            }
+        }
+        pos += attributeSize;
+    }
+
+    header.format = "exr";
+    header.bitsPerChannel = maxChannelBits;
+}
+
+inline void parseTiff(std::ifstream& file, const unsigned char* data, ImageHeader& header) {
+    const bool littleEndian = data[0] == 'I';
+    auto read16 = [littleEndian](const unsigned char* p) { return littleEndian ? readLE16(p) : readBE16(p); };
+    auto read32 = [littleEndian](const unsigned char* p) { return littleEndian ? readLE32(p) : readBE32(p); };
+
+    // Only the first image file directory is inspected
+    file.seekg(read32(data + 4));
+    unsigned char countBytes[2];
+    if (!file.read(reinterpret_cast<char*>(countBytes), 2)) {
+        return;
+    }
+    const uint32_t entryCount = read16(countBytes);
+    std::vector<unsigned char> entries(entryCount * 12);
+    if (!file.read(reinterpret_cast<char*>(entries.data()), static_cast<std::streamsize>(entries.size()))) {
+        return;
+    }
+
+    header.channels = 1;  // SamplesPerPixel defaults to 1
+    for (uint32_t i = 0; i < entryCount; ++i) {
+        const unsigned char* entry = entries.data() + i * 12;
+        const uint32_t tag = read16(entry);
+        const uint32_t fieldType = read16(entry + 2);
+        // SHORT values sit in the first half of the value field, LONG values fill it
+        const uint32_t value = fieldType == 3 ? read16(entry + 8) : read32(entry + 8);
+        switch (tag) {
+            case 256: header.width = value; break;
+            case 257: header.height = value; break;
+            // Per-sample depths stored out of line are assumed to be the common 8 bits
+            case 258: header.bitsPerChannel = read32(entry + 4) <= 2 ? value : 8; break;
+            case 277: header.channels = value; break;
+            default: break;
+        }
+    }
+    if (header.bitsPerChannel == 0) {
+        header.bitsPerChannel = 1;  // BitsPerSample defaults to 1
+    }
+    header.format = "tiff";
+}
+
+inline void parseHdr(const unsigned char* data, size_t size, ImageHeader& header) {
+    // Header lines end with a blank line, followed by the resolution string "-Y <h> +X <w>"
+    const std::string text(reinterpret_cast<const char*>(data), size);
+    const size_t blank = text.find("\n\n");
+    if (blank == std::string::npos) {
+        return;
+    }
+    unsigned long height = 0, width = 0;
+    char yAxis[3] = {}, xAxis[3] = {};
+    if (std::sscanf(text.c_str() + blank + 2, "%2s %lu %2s %lu", yAxis, &height, xAxis, &width) != 4) {
+        return;
+    }
+    header.format = "hdr";
+    header.width = static_cast<uint32_t>(width);
+    header.height = static_cast<uint32_t>(height);
+    header.channels = 3;
+    header.bitsPerChannel = 32;  // RGBE decodes to float
+}
+
+} // namespace imageHeader
+
+/**
+ * @brief Identifies an image file from its magic bytes and reads its header.
+ *
+ * Only the header is read; pixel data is never touched, so probing is cheap even for very
+ * large textures.
+ *
+ * @param path Filesystem path of the image.
+ * @return ImageHeader The parsed header; ImageHeader::format is empty if the file is missing,
+ *         unreadable or of an unrecognized format.
+ */
+inline ImageHeader readImageHeader(const std::string& path) {
+    using namespace imageHeader;
+
+    ImageHeader header;
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return header;
+    }
+
+    unsigned char prefix[kPrefixBytes] = {};
+    file.read(reinterpret_cast<char*>(prefix), kPrefixBytes);
+    const size_t size = static_cast<size_t>(file.gcount());
+    file.clear();
+
+    if (size >= 8 && std::memcmp(prefix, "\x89PNG\r\n\x1a\n", 8) == 0) {
+        parsePng(prefix, size, header);
+    } else if (size >= 3 && prefix[0] == 0xFF && prefix[1] == 0xD8 && prefix[2] == 0xFF) {
+        parseJpeg(file, header);
+    } else if (size >= 4 && readLE32(prefix) == 20000630) {
+        parseExr(file, header);
+    } else if (size >= 8 && (std::memcmp(prefix, "II*\0", 4) == 0 || std::memcmp(prefix, "MM\0*", 4) == 0)) {
+        parseTiff(file, prefix, header);
+    } else if (size >= 30 && prefix[0] == 'B' && prefix[1] == 'M') {
+        header.format = "bmp";
+        header.width = readLE32(prefix + 18);
+        const int32_t height = static_cast<int32_t>(readLE32(prefix + 22));  // Negative for top-down
+        header.height = static_cast<uint32_t>(height < 0 ? -height : height);
+        const uint32_t bitsPerPixel = readLE16(prefix + 28);
+        header.channels = bitsPerPixel >= 24 ? bitsPerPixel / 8 : 3;  // Palettes expand to RGB
+        header.bitsPerChannel = 8;
+    } else if (size >= 10 && (std::memcmp(prefix, "#?RADIANCE", 10) == 0 || std::memcmp(prefix, "#?RGBE", 6) == 0)) {
+        parseHdr(prefix, size, header);
+    } else if (size >= 18 && extensionOf(path) == "tga") {
+        header.format = "tga";
+        header.width = readLE16(prefix + 12);
+        header.height = readLE16(prefix + 14);
+        const uint32_t bitsPerPixel = prefix[16];
+        header.channels = prefix[2] == 3 || prefix[2] == 11 ? 1 : (bitsPerPixel == 32 ? 4 : 3);
+        header.bitsPerChannel = 8;
+    }
+
+    return header;
+}
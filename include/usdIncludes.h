@@ -1,21 +1,73 @@
 #pragma once
 
+#include <pxr/pxr.h>
 #include <pxr/usd/usd/stage.h>
 #include <pxr/usd/usd/primRange.h>
 #include <pxr/usd/usd/variantSets.h>
+#include <pxr/usd/usd/modelAPI.h>
+#include <pxr/usd/usd/collectionAPI.h>
+#include <pxr/usd/usd/schemaRegistry.h>
+#include <pxr/usd/usd/clipsAPI.h>
+#include <pxr/usd/usd/tokens.h>
+#include <pxr/usd/kind/registry.h>
+#include <pxr/usd/sdf/types.h>
+#include <pxr/usd/sdf/assetPath.h>
+#include <pxr/usd/sdf/layerUtils.h>
+#include <pxr/usd/sdf/propertySpec.h>
+#include <pxr/usd/ar/resolver.h>
+#include <pxr/usd/ar/resolverContextBinder.h>
 #include <pxr/usd/usdGeom/xform.h>
+#include <pxr/usd/usdGeom/boundable.h>
+#include <pxr/usd/usdGeom/gprim.h>
 #include <pxr/usd/usdGeom/mesh.h>
+#include <pxr/usd/usdGeom/subset.h>
+#include <pxr/usd/usdGeom/pointInstancer.h>
+#include <pxr/usd/usdGeom/basisCurves.h>
+#include <pxr/usd/usdGeom/points.h>
+#include <pxr/usd/usdGeom/primvarsAPI.h>
+#include <pxr/usd/usdGeom/tokens.h>
+#include <pxr/usd/usdSkel/bindingAPI.h>
+#include <pxr/usd/usdSkel/skeleton.h>
 #include <pxr/base/tf/token.h>
+#include <pxr/base/tf/stringUtils.h>
+#include <pxr/base/arch/systemInfo.h>
 #include <pxr/base/vt/array.h>
+#include <pxr/base/vt/value.h>
+#include <pxr/base/gf/matrix4d.h>
+#include <pxr/base/gf/quatf.h>
+#include <pxr/base/tf/type.h>
+#include <pxr/base/work/loops.h>
 #include <pxr/usd/usdShade/shader.h>
 #include <pxr/usd/usdShade/material.h>
+#include <pxr/usd/usdShade/nodeGraph.h>
 #include <pxr/usd/usdShade/input.h>
 #include <pxr/usd/usdShade/output.h>
 #include <pxr/usd/usdShade/connectableAPI.h>
+#include <pxr/usd/usdShade/materialBindingAPI.h>
+#include <pxr/usd/usdShade/tokens.h>
+#include <pxr/usd/sdr/registry.h>
+#include <pxr/usd/sdr/shaderNode.h>
+#include <pxr/usd/sdr/shaderProperty.h>
+
+#include <tbb/enumerable_thread_specific.h>
 
 #include <iostream>
 #include <vector>
 #include <string>
 #include <functional>
 #include <unordered_set>
+#include <unordered_map>
+#include <map>
+#include <set>
+#include <memory>
+#include <algorithm>
+#include <iterator>
+#include <tuple>
 #include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <limits>
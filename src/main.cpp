@@ -13,10 +13,70 @@
  * -only-shaders     : Run only shader validation
  * -only-layers      : Run only layer structure validation
  * -only-variants    : Run only variant validation
+ * -only-normals     : Run only normals validation
  * -skip-geometry    : Skip geometry validation
  * -skip-shaders     : Skip shader validation
  * -skip-layers      : Skip layer structure validation
  * -skip-variants    : Skip variant validation
+ * -skip-normals     : Skip normals validation
+ * -only-statistics  : Run only the scene statistics census
+ * -skip-statistics  : Skip the scene statistics census
+ * -only-instancers  : Run only point instancer validation
+ * -skip-instancers  : Skip point instancer validation
+ * -only-curves      : Run only basis curves and points validation
+ * -skip-curves      : Skip basis curves and points validation
+ * -only-skinning    : Run only skinning validation
+ * -skip-skinning    : Skip skinning validation
+ * -only-memory      : Run only the render memory estimate
+ * -skip-memory      : Skip the render memory estimate
+ * -only-ranges      : Run only attribute value range validation
+ * -skip-ranges      : Skip attribute value range validation
+ * -only-hierarchy   : Run only hierarchy depth and fan-out analysis
+ * -skip-hierarchy   : Skip hierarchy depth and fan-out analysis
+ * -only-subsets     : Run only geom subset validation
+ * -skip-subsets     : Skip geom subset validation
+ * -only-meshpoints  : Run only unreferenced and coincident mesh point detection
+ * -skip-meshpoints  : Skip unreferenced and coincident mesh point detection
+ * -only-networks    : Run only material network validation
+ * -skip-networks    : Skip material network validation
+ * -only-bindings    : Run only material binding validation
+ * -skip-bindings    : Skip material binding validation
+ * -only-textures    : Run only texture asset validation
+ * -skip-textures    : Skip texture asset validation
+ * -only-definitions : Run only shader definition validation against the registry
+ * -skip-definitions : Skip shader definition validation against the registry
+ * -only-duplicates  : Run only structurally identical material detection
+ * -skip-duplicates  : Skip structurally identical material detection
+ * -only-orphans     : Run only unused material and unreachable shader detection
+ * -skip-orphans     : Skip unused material and unreachable shader detection
+ * -only-conntypes   : Run only shader connection type compatibility validation
+ * -skip-conntypes   : Skip shader connection type compatibility validation
+ * -only-texmem      : Run only the texture memory estimate
+ * -skip-texmem      : Skip the texture memory estimate
+ * -only-targets     : Run only relationship target and connection existence validation
+ * -skip-targets     : Skip relationship target and connection existence validation
+ * -only-collections : Run only collection membership validation
+ * -skip-collections : Skip collection membership validation
+ * -only-kinds       : Run only model hierarchy (kind) validation
+ * -skip-kinds       : Skip model hierarchy (kind) validation
+ * -only-schemas     : Run only schema registry validation of prim types and API schemas
+ * -skip-schemas     : Skip schema registry validation of prim types and API schemas
+ * -only-timesamples : Run only time sample validation and animation cost report
+ * -skip-timesamples : Skip time sample validation and animation cost report
+ * -only-redundant   : Run only redundant time sample detection
+ * -skip-redundant   : Skip redundant time sample detection
+ * -only-assets      : Run only resolution of every asset path on the stage
+ * -skip-assets      : Skip resolution of every asset path on the stage
+ * -max-<budget> <n> : Fail the census when a scene total exceeds n (prims, faces, vertices,
+ *                     primvar-bytes, materials), the memory estimate exceeds n
+ *                     bytes (memory-bytes), the hierarchy exceeds n levels or
+ *                     direct children (depth, children), or texture memory exceeds
+ *                     n bytes in the scene or any material or model
+ *                     (texture-bytes, material-texture-bytes,
+ *                     model-texture-bytes), or an attribute has more than
+ *                     n time samples (time-samples, 100000 by default)
+ * -range-rules <path> : Read the value range rules from path instead of the
+ *                     data/value_range_rules.txt next to the executable
  * -output <path>    : Export results to the specified file path
  * -help             : Display this help message
  * 
@@ -26,6 +86,18 @@
  */
 
 #include "usdIncludes.h"
+#include "arrayKernels.h"
+#include "imageHeader.h"
+
+/**
+ * @brief Returns the path of the value range rules shipped with the tool.
+ *
+ * The build copies data/value_range_rules.txt next to the executable, so the rules are found
+ * wherever the runner is moved or installed as long as its data directory travels with it.
+ */
+std::string defaultRangeRulesPath() {
+    return pxr::TfGetPathName(pxr::ArchGetExecutablePath()) + "data/value_range_rules.txt";
+}
 
 /**
  * @struct TestResult
@@ -61,11 +133,127 @@ struct TestConfig {
     bool runShaders = true;
     bool runLayers = true;
     bool runVariants = true;
+    bool runNormals = true;
+    bool runStatistics = true;
+    bool runInstancers = true;
+    bool runCurves = true;
+    bool runSkinning = true;
+    bool runMemory = true;
+    bool runRanges = true;
+    bool runHierarchy = true;
+    bool runSubsets = true;
+    bool runMeshPoints = true;
+    bool runNetworks = true;
+    bool runBindings = true;
+    bool runTextures = true;
+    bool runDefinitions = true;
+    bool runDuplicates = true;
+    bool runOrphans = true;
+    bool runConnectionTypes = true;
+    bool runTextureMemory = true;
+    bool runTargets = true;
+    bool runCollections = true;
+    bool runKinds = true;
+    bool runSchemas = true;
+    bool runTimeSamples = true;
+    bool runRedundantSamples = true;
+    bool runAssets = true;
     std::string outputPath;
 
+    // Rules file read by the value range validation
+    std::string rangeRulesPath = defaultRangeRulesPath();
+
+    // Scene budgets enforced by the statistics census (0 means unlimited)
+    size_t maxPrims = 0;
+    size_t maxFaces = 0;
+    size_t maxVertices = 0;
+    size_t maxPrimvarBytes = 0;
+    size_t maxMaterials = 0;
+
+    // Render memory budget enforced by the memory estimate (0 means unlimited)
+    size_t maxMemoryBytes = 0;
+
+    // Texture memory budgets enforced by the texture memory estimate (0 means unlimited)
+    size_t maxTextureBytes = 0;
+    size_t maxMaterialTextureBytes = 0;
+    size_t maxModelTextureBytes = 0;
+
+    // Hierarchy limits enforced by the depth and fan-out analysis (0 means unlimited)
+    size_t maxDepth = 0;
+    size_t maxChildren = 0;
+
+    // Per-attribute sample count limit enforced by the time sample validation (0 means unlimited)
+    size_t maxTimeSamples = 100000;
+
+    // Test identifiers (as used by addTest and the -only-<id>/-skip-<id> flags) paired with their toggle
+    static const std::vector<std::pair<std::string, bool TestConfig::*>>& testFlags() {
+        static const std::vector<std::pair<std::string, bool TestConfig::*>> flags = {
+            {"geometry", &TestConfig::runGeometry},
+            {"shaders", &TestConfig::runShaders},
+            {"layers", &TestConfig::runLayers},
+            {"variants", &TestConfig::runVariants},
+            {"normals", &TestConfig::runNormals},
+            {"statistics", &TestConfig::runStatistics},
+            {"instancers", &TestConfig::runInstancers},
+            {"curves", &TestConfig::runCurves},
+            {"skinning", &TestConfig::runSkinning},
+            {"memory", &TestConfig::runMemory},
+            {"ranges", &TestConfig::runRanges},
+            {"hierarchy", &TestConfig::runHierarchy},
+            {"subsets", &TestConfig::runSubsets},
+            {"meshpoints", &TestConfig::runMeshPoints},
+            {"networks", &TestConfig::runNetworks},
+            {"bindings", &TestConfig::runBindings},
+            {"textures", &TestConfig::runTextures},
+            {"definitions", &TestConfig::runDefinitions},
+            {"duplicates", &TestConfig::runDuplicates},
+            {"orphans", &TestConfig::runOrphans},
+            {"conntypes", &TestConfig::runConnectionTypes},
+            {"texmem", &TestConfig::runTextureMemory},
+            {"targets", &TestConfig::runTargets},
+            {"collections", &TestConfig::runCollections},
+            {"kinds", &TestConfig::runKinds},
+            {"schemas", &TestConfig::runSchemas},
+            {"timesamples", &TestConfig::runTimeSamples},
+            {"redundant", &TestConfig::runRedundantSamples},
+            {"assets", &TestConfig::runAssets},
+        };
+        return flags;
+    }
+
+    // Command line options taking a numeric threshold, paired with the member they set
+    static const std::vector<std::pair<std::string, size_t TestConfig::*>>& thresholdOptions() {
+        static const std::vector<std::pair<std::string, size_t TestConfig::*>> options = {
+            {"-max-prims", &TestConfig::maxPrims},
+            {"-max-faces", &TestConfig::maxFaces},
+            {"-max-vertices", &TestConfig::maxVertices},
+            {"-max-primvar-bytes", &TestConfig::maxPrimvarBytes},
+            {"-max-materials", &TestConfig::maxMaterials},
+            {"-max-memory-bytes", &TestConfig::maxMemoryBytes},
+            {"-max-depth", &TestConfig::maxDepth},
+            {"-max-children", &TestConfig::maxChildren},
+            {"-max-texture-bytes", &TestConfig::maxTextureBytes},
+            {"-max-material-texture-bytes", &TestConfig::maxMaterialTextureBytes},
+            {"-max-model-texture-bytes", &TestConfig::maxModelTextureBytes},
+            {"-max-time-samples", &TestConfig::maxTimeSamples},
+        };
+        return options;
+    }
+
+    // Returns true if the test with the given identifier is enabled
+    bool isEnabled(const std::string& id) const {
+        for (const auto& [name, flag] : testFlags()) {
+            if (name == id) return this->*flag;
+        }
+        return false;
+    }
+
     // Returns true if at least one test is enabled
     bool hasEnabledTests() const {
-        return runGeometry || runShaders || runLayers || runVariants;
+        for (const auto& [name, flag] : testFlags()) {
+            if (this->*flag) return true;
+        }
+        return false;
     }
 };
 
@@ -117,10 +305,7 @@ public:
         }
 
         for (const auto& [id, test] : tests) {
-            if ((id == "geometry" && config.runGeometry) ||
-                (id == "shaders" && config.runShaders) ||
-                (id == "layers" && config.runLayers) ||
-                (id == "variants" && config.runVariants)) {
+            if (config.isEnabled(id)) {
                 TestResult result = test(stage);
                 report(result);
             }
@@ -299,6 +484,8 @@ TestResult validateGeometry(const pxr::UsdStageRefPtr& stage) {
  * - Valid connections to other shaders or materials.
  * - Presence of valid shader source asset paths.
  *
+ * Material outputs are checked once per material by validateMaterialNetworks().
+ *
  * If no shaders are found, validation passes unless they are required.
  *
  * @param stage The USD stage to validate.
@@ -354,21 +541,6 @@ TestResult validateShaders(const pxr::UsdStageRefPtr& stage) {
                     errors.push_back("Missing shader source asset path at: " + prim.GetPath().GetString());
                 }
             }
-
-            if (auto material = pxr::UsdShadeMaterial(prim.GetParent())) {
-                auto surface = material.GetSurfaceOutput();
-                if (surface) {
-                    pxr::UsdShadeConnectableAPI source;
-                    pxr::TfToken sourceName;
-                    pxr::UsdShadeAttributeType sourceType;
-                    if (surface.GetConnectedSource(&source, &sourceName, &sourceType)) {
-                        if (!source.GetPrim().IsValid()) {
-                            errors.push_back("Invalid material binding at: " + 
-                                             prim.GetParent().GetPath().GetString());
-                        }
-                    }
-                }
-            }
         }
     }
 
@@ -596,171 +768,4936 @@ TestResult validateVariants(const pxr::UsdStageRefPtr& stage) {
 }
 
 /**
- * @brief Displays the usage instructions and available options for the USD test runner program.
- */ 
-void displayHelp() {
-    std::cout << R"(
-Usage: usdTestRunner <path-to-usd-file> [options]
-
-Options:
-  -only-geometry    Run only geometry validation
-  -only-shaders     Run only shader validation
-  -only-layers      Run only layer structure validation
-  -skip-geometry    Skip geometry validation
-  -skip-shaders     Skip shader validation
-  -skip-layers      Skip layer structure validation
-  -output <path>    Export results to specified file path
-  -help             Display this help message
+ * @brief Returns the number of elements a mesh primvar must have for the given interpolation.
+ *
+ * Only the topology arrays needed for the requested interpolation are read.
+ *
+ * @param mesh The mesh the primvar belongs to.
+ * @param interpolation The primvar's declared interpolation.
+ * @return The expected element count, or -1 if the interpolation is not recognized.
+ */
+int64_t expectedPrimvarCount(const pxr::UsdGeomMesh& mesh, const pxr::TfToken& interpolation) {
+    if (interpolation == pxr::UsdGeomTokens->constant) {
+        return 1;
+    }
+    if (interpolation == pxr::UsdGeomTokens->uniform) {
+        pxr::VtIntArray faceVertexCounts;
+        mesh.GetFaceVertexCountsAttr().Get(&faceVertexCounts);
+        return static_cast<int64_t>(faceVertexCounts.size());
+    }
+    if (interpolation == pxr::UsdGeomTokens->vertex || interpolation == pxr::UsdGeomTokens->varying) {
+        pxr::VtVec3fArray points;
+        mesh.GetPointsAttr().Get(&points);
+        return static_cast<int64_t>(points.size());
+    }
+    if (interpolation == pxr::UsdGeomTokens->faceVarying) {
+        pxr::VtIntArray faceVertexIndices;
+        mesh.GetFaceVertexIndicesAttr().Get(&faceVertexIndices);
+        return static_cast<int64_t>(faceVertexIndices.size());
+    }
+    return -1;
+}
 
-Note: 
-- 'only' flags and 'skip' flags are mutually exclusive
-- Multiple 'skip' flags can be combined
-- Only one 'only' flag can be used at a time
-)";
+/**
+ * @brief Formats a count as a percentage of a total with one decimal place.
+ */
+std::string formatPercent(size_t count, size_t total) {
+    std::ostringstream stream;
+    stream << std::fixed << std::setprecision(1)
+           << (total > 0 ? 100.0 * static_cast<double>(count) / static_cast<double>(total) : 0.0) << "%";
+    return stream.str();
 }
 
 /**
- * @brief Parses command line arguments to determine test configuration
- * @param argc Number of arguments
- * @param argv Array of arguments
- * @return TestConfig object with enabled/disabled tests
+ * @brief Validates authored normals on every mesh in a USD file.
+ *
+ * Normals are read from `primvars:normals` when authored, falling back to the `normals`
+ * attribute, and are checked for:
+ * - Unit length, using a vectorized squared-length deviation scan.
+ * - Finite components (no NaN or infinity).
+ * - An element count matching the topology for the declared interpolation.
+ *
+ * Reports the fraction of bad normals per mesh so the worst offenders can be triaged.
+ * Passes if no mesh has authored normals.
+ *
+ * @param stage The USD stage to validate.
+ * @return TestResult Containing:
+ *         - Test name ("Validate Normals").
+ *         - Success/failure status.
+ *         - Detailed validation results or errors.
  */
-TestConfig parseArguments(int argc, char* argv[]) {
-    TestConfig config;
-    std::unordered_set<std::string> args;
-    
-    // Collect all arguments
-    for (int i = 1; i < argc; ++i) {
-        args.insert(argv[i]);
-        
-        // Check for output path
-        if (std::string(argv[i]) == "-output" && i + 1 < argc) {
-            config.outputPath = argv[i + 1];
-            ++i;  // Skip the next argument since it's the path
-        }
+TestResult validateNormals(const pxr::UsdStageRefPtr& stage) {
+    if (!stage) {
+        return {"Validate Normals", false, "Invalid stage reference."};
     }
 
-    // Check for help flag first
-    if (args.count("-help")) {
-        displayHelp();
-        exit(0);
-    }
+    // Allowed deviation of the squared length from 1 (roughly 0.05% in length)
+    static constexpr float kSquaredLengthTolerance = 1e-3f;
 
-    // Now check for USD file path
-    if (argc < 2 || argv[1][0] == '-') {  // First argument missing or is a flag
-        displayHelp();
-        exit(1);
-    }
+    bool foundAnyNormals = false;
+    std::vector<std::string> errors;
 
-    // Handle 'only' flags
-    if (args.count("-only-geometry")) {
-        config.runGeometry = true;
-        config.runShaders = false;
-        config.runLayers = false;
-        config.runVariants = false;
-    } else if (args.count("-only-shaders")) {
-        config.runGeometry = false;
-        config.runShaders = true;
-        config.runLayers = false;
-        config.runVariants = false;
-    } else if (args.count("-only-layers")) {
-        config.runGeometry = false;
-        config.runShaders = false;
-        config.runLayers = true;
-        config.runVariants = false;
-    } else if (args.count("-only-variants")) {
-        config.runGeometry = false;
-        config.runShaders = false;
-        config.runLayers = false;
-        config.runVariants = true;
-    } else {
-        // Handle 'skip' flags
-        if (args.count("-skip-geometry")) config.runGeometry = false;
-        if (args.count("-skip-shaders")) config.runShaders = false;
-        if (args.count("-skip-layers")) config.runLayers = false;
-        if (args.count("-skip-variants")) config.runLayers = false;
-    }
+    for (auto prim : stage->Traverse()) {
+        auto mesh = pxr::UsdGeomMesh(prim);
+        if (!mesh) {
+            continue;
+        }
 
-    // Validate arguments
-    int onlyFlags = args.count("-only-geometry") + args.count("-only-shaders") + 
-                   args.count("-only-layers") + args.count("-only-variants");
-    
-    if (onlyFlags > 1) {
-        std::cerr << "Error: Only one '-only' flag can be used at a time.\n";
-        displayHelp();
-        exit(1);
+        const std::string path = prim.GetPath().GetString();
+        pxr::VtVec3fArray normals;
+        pxr::TfToken interpolation;
+        size_t elementCount = 0;
+
+        pxr::UsdGeomPrimvar primvar = pxr::UsdGeomPrimvarsAPI(prim).GetPrimvar(pxr::UsdGeomTokens->normals);
+        if (primvar && primvar.HasAuthoredValue()) {
+            if (!primvar.Get(&normals)) {
+                errors.push_back("Unreadable normals primvar at: " + path);
+                continue;
+            }
+            interpolation = primvar.GetInterpolation();
+            pxr::VtIntArray indices;
+            elementCount = primvar.GetIndices(&indices) ? indices.size() : normals.size();
+        } else if (mesh.GetNormalsAttr().HasAuthoredValue()) {
+            if (!mesh.GetNormalsAttr().Get(&normals)) {
+                errors.push_back("Unreadable normals attribute at: " + path);
+                continue;
+            }
+            interpolation = mesh.GetNormalsInterpolation();
+            elementCount = normals.size();
+        } else {
+            continue;
+        }
+
+        foundAnyNormals = true;
+
+        int64_t expected = expectedPrimvarCount(mesh, interpolation);
+        if (expected < 0) {
+            errors.push_back("Unknown normals interpolation '" + interpolation.GetString() + "' at: " + path);
+        } else if (static_cast<int64_t>(elementCount) != expected) {
+            errors.push_back("Normals count mismatch at " + path + ": " + std::to_string(elementCount) +
+                             " authored for '" + interpolation.GetString() + "' interpolation, expected " +
+                             std::to_string(expected));
+        }
+
+        const size_t count = normals.size();
+        const float* data = reinterpret_cast<const float*>(normals.cdata());
+        size_t nonUnit = arrayKernels::parallelCount(count, [data](size_t begin, size_t end) {
+            return arrayKernels::countNonUnitVec3(data, begin, end, kSquaredLengthTolerance);
+        });
+        if (nonUnit > 0) {
+            size_t nonFinite = arrayKernels::parallelCount(count, [data](size_t begin, size_t end) {
+                return arrayKernels::countNonFiniteTuples<3>(data, begin, end);
+            });
+            std::string error = "Non-unit normals at " + path + ": " + std::to_string(nonUnit) + " of " +
+                                std::to_string(count) + " (" + formatPercent(nonUnit, count) + ")";
+            if (nonFinite > 0) {
+                error += ", including " + std::to_string(nonFinite) + " non-finite";
+            }
+            errors.push_back(error);
+        }
     }
 
-    // Check for invalid combination of 'only' and 'skip' flags
-    if (onlyFlags > 0 && (args.count("-skip-geometry") || args.count("-skip-shaders") || 
-                         args.count("-skip-layers") || args.count("-only-variants"))) {
-        std::cerr << "Error: Cannot combine '-only' and '-skip' flags.\n";
-        displayHelp();
-        exit(1);
+    if (!foundAnyNormals) {
+        return {
+            "Validate Normals",
+            true,
+            "No authored normals found in the scene, which is acceptable."
+        };
     }
 
-    if (!config.hasEnabledTests()) {
-        std::cerr << "Error: Cannot skip all tests. At least one test must run.\n";
-        displayHelp();
-        exit(1);
+    if (!errors.empty()) {
+        std::string errorMsg = "Normals validation failed with the following issues:\n";
+        for (const auto& err : errors) {
+            errorMsg += "- " + err + "\n";
+        }
+        return {"Validate Normals", false, errorMsg};
     }
 
-    return config;
+    return {"Validate Normals", true, "All normals are unit length, finite and match their interpolation."};
 }
 
 /**
- * @brief Displays the program introduction with ASCII art and a description of the tool.
+ * @brief Validates every UsdGeomPointInstancer in a USD file.
+ *
+ * Ensures that instance arrays are consistent and usable by:
+ * - Checking protoIndices against the number of targets in the prototypes relationship.
+ * - Verifying that positions, orientations, scales, velocities and ids match protoIndices in length.
+ * - Scanning positions, orientations and scales for NaN or infinite values.
+ * - Checking invisibleIds against the authored ids, or against instance indices when no ids are authored.
+ *
+ * Instancers carry the largest arrays in a scene, so every scan is a vectorizable kernel run in
+ * parallel chunks over the array.
+ *
+ * @param stage The USD stage to validate.
+ * @return TestResult Containing:
+ *         - Test name ("Validate Point Instancers").
+ *         - Success/failure status.
+ *         - Detailed validation results or errors.
  */
-void displayIntro() {
-    std::cout << R"(
-   ___      ___       ________      _________
-  |   |    |   |    /   ___   \    |         \
-  |   |    |   |   |   /   \___|   |    ___   \
-  |   |    |   |   |   \______     |   |   |   |
-  |   |    |   |    \______   \    |   |   |   |
-  |   |____|   |    ___    \   \   |   |___|   |
-  |            |   |   \___/   |   |          /
-   \__________/     \_________/    |_________/
-    )" << '\n';
+TestResult validatePointInstancers(const pxr::UsdStageRefPtr& stage) {
+    if (!stage) {
+        return {"Validate Point Instancers", false, "Invalid stage reference."};
+    }
 
-    std::cout << "\nWelcome to the USD Test Runner!\n";
-    std::cout << "This program validates USD files for geometry, shaders, and layer structure.\n";
-    std::cout << "Provide a USD file as input to test its compliance with basic asset standards.\n";
-    std::cout << "\nFor further details, view the README file located in the root directory.\n";
-    std::cout << "------------------------------------------------------------\n\n";
+    bool foundAnyInstancer = false;
+    std::vector<std::string> errors;
+
+    for (auto prim : stage->Traverse()) {
+        auto instancer = pxr::UsdGeomPointInstancer(prim);
+        if (!instancer) {
+            continue;
+        }
+
+        foundAnyInstancer = true;
+        const std::string path = prim.GetPath().GetString();
+
+        pxr::SdfPathVector prototypes;
+        instancer.GetPrototypesRel().GetTargets(&prototypes);
+
+        pxr::VtIntArray protoIndices;
+        instancer.GetProtoIndicesAttr().Get(&protoIndices);
+        const size_t instanceCount = protoIndices.size();
+
+        const int* indexData = protoIndices.cdata();
+        const size_t prototypeCount = prototypes.size();
+        size_t badIndices = arrayKernels::parallelCount(instanceCount, [=](size_t begin, size_t end) {
+            return arrayKernels::countOutOfRange(indexData, begin, end, prototypeCount);
+        });
+        if (badIndices > 0) {
+            errors.push_back("Out of range protoIndices at " + path + ": " + std::to_string(badIndices) +
+                             " of " + std::to_string(instanceCount) + " outside [0, " +
+                             std::to_string(prototypeCount) + ")");
+        }
+
+        pxr::VtVec3fArray positions, scales, velocities, angularVelocities;
+        pxr::VtQuathArray orientations;
+        pxr::VtQuatfArray orientationsf;
+        pxr::VtInt64Array ids;
+        instancer.GetPositionsAttr().Get(&positions);
+        instancer.GetScalesAttr().Get(&scales);
+        instancer.GetVelocitiesAttr().Get(&velocities);
+        instancer.GetAngularVelocitiesAttr().Get(&angularVelocities);
+        instancer.GetOrientationsAttr().Get(&orientations);
+        instancer.GetIdsAttr().Get(&ids);
+        // Full precision orientations only exist in newer schema versions, so look them up by name
+        if (auto orientationsfAttr = prim.GetAttribute(pxr::TfToken("orientationsf"))) {
+            orientationsfAttr.Get(&orientationsf);
+        }
+
+        // Positions are required for every instance; the optional arrays only when authored
+        const std::vector<std::pair<std::string, size_t>> arraySizes = {
+            {"positions", positions.size()},
+            {"orientations", orientations.size()},
+            {"orientationsf", orientationsf.size()},
+            {"scales", scales.size()},
+            {"velocities", velocities.size()},
+            {"angularVelocities", angularVelocities.size()},
+            {"ids", ids.size()},
+        };
+        for (const auto& [name, size] : arraySizes) {
+            if (size != instanceCount && (size > 0 || name == "positions")) {
+                errors.push_back("Array length mismatch at " + path + ": " + name + " has " +
+                                 std::to_string(size) + " entries, expected " +
+                                 std::to_string(instanceCount) + " (protoIndices)");
+            }
+        }
+
+        const float* positionData = reinterpret_cast<const float*>(positions.cdata());
+        const float* scaleData = reinterpret_cast<const float*>(scales.cdata());
+        const float* orientationfData = reinterpret_cast<const float*>(orientationsf.cdata());
+        const uint16_t* orientationData = reinterpret_cast<const uint16_t*>(orientations.cdata());
+        const std::vector<std::tuple<std::string, size_t, size_t>> nonFinite = {
+            {"positions", positions.size(), arrayKernels::parallelCount(positions.size(), [=](size_t begin, size_t end) {
+                return arrayKernels::countNonFiniteTuples<3>(positionData, begin, end);
+            })},
+            {"orientations", orientations.size(), arrayKernels::parallelCount(orientations.size(), [=](size_t begin, size_t end) {
+                return arrayKernels::countNonFiniteHalfTuples<4>(orientationData, begin, end);
+            })},
+            {"orientationsf", orientationsf.size(), arrayKernels::parallelCount(orientationsf.size(), [=](size_t begin, size_t end) {
+                return arrayKernels::countNonFiniteTuples<4>(orientationfData, begin, end);
+            })},
+            {"scales", scales.size(), arrayKernels::parallelCount(scales.size(), [=](size_t begin, size_t end) {
+                return arrayKernels::countNonFiniteTuples<3>(scaleData, begin, end);
+            })},
+        };
+        for (const auto& [name, size, bad] : nonFinite) {
+            if (bad > 0) {
+                errors.push_back("Non-finite " + name + " at " + path + ": " + std::to_string(bad) +
+                                 " of " + std::to_string(size) + " (" + formatPercent(bad, size) + ")");
+            }
+        }
+
+        pxr::VtInt64Array invisibleIds;
+        instancer.GetInvisibleIdsAttr().Get(&invisibleIds);
+        if (!invisibleIds.empty()) {
+            const int64_t* invisibleData = invisibleIds.cdata();
+            size_t badInvisible = 0;
+            if (ids.empty()) {
+                // Without ids, invisibleIds refer to instance indices
+                badInvisible = arrayKernels::parallelCount(invisibleIds.size(), [=](size_t begin, size_t end) {
+                    return arrayKernels::countOutOfRange(invisibleData, begin, end, instanceCount);
+                });
+            } else {
+                std::vector<int64_t> sortedIds(ids.cbegin(), ids.cend());
+                std::sort(sortedIds.begin(), sortedIds.end());
+                badInvisible = arrayKernels::parallelCount(invisibleIds.size(), [&](size_t begin, size_t end) {
+                    size_t missing = 0;
+                    for (size_t i = begin; i < end; ++i) {
+                        missing += !std::binary_search(sortedIds.begin(), sortedIds.end(), invisibleData[i]);
+                    }
+                    return missing;
+                });
+            }
+            if (badInvisible > 0) {
+                errors.push_back("Out of range invisibleIds at " + path + ": " + std::to_string(badInvisible) +
+                                 " of " + std::to_string(invisibleIds.size()) +
+                                 (ids.empty() ? " are not instance indices" : " do not match any authored id"));
+            }
+        }
+    }
+
+    if (!foundAnyInstancer) {
+        return {
+            "Validate Point Instancers",
+            true,
+            "No point instancers found in the scene, which is acceptable."
+        };
+    }
+
+    if (!errors.empty()) {
+        std::string errorMsg = "Point instancer validation failed with the following issues:\n";
+        for (const auto& err : errors) {
+            errorMsg += "- " + err + "\n";
+        }
+        return {"Validate Point Instancers", false, errorMsg};
+    }
+
+    return {"Validate Point Instancers", true, "All point instancers have consistent, finite instance arrays."};
 }
 
 /**
- * @brief Entry point for the program.
+ * @brief Validates UsdGeomBasisCurves and UsdGeomPoints prims in a USD file.
  *
- * @param argc The number of command-line arguments.
- * @param argv Array of command-line arguments.
- * @return Exit status of the program.
+ * For basis curves, checks that:
+ * - curveVertexCounts sum to the number of points.
+ * - Each curve has the minimum vertex count for its type, basis and wrap mode, and cubic
+ *   bezier curves fit a whole number of segments.
+ * - widths are sized for their interpolation.
+ *
+ * For points, checks that widths are sized for their interpolation.
+ *
+ * Grooms carry tens of millions of curve vertices, so all per-curve reductions run as
+ * vectorizable kernels in parallel chunks over curveVertexCounts.
+ *
+ * @param stage The USD stage to validate.
+ * @return TestResult Containing:
+ *         - Test name ("Validate Curves and Points").
+ *         - Success/failure status.
+ *         - Detailed validation results or errors.
  */
-int main(int argc, char* argv[]) {
-    // Check for help flag before anything else
-    if (argc > 1 && std::string(argv[1]) == "-help") {
-        displayHelp();
-        return 0;
+TestResult validateCurvesAndPoints(const pxr::UsdStageRefPtr& stage) {
+    if (!stage) {
+        return {"Validate Curves and Points", false, "Invalid stage reference."};
     }
 
-    // Missing arguments case
-    if (argc < 2) {
-        displayHelp();
-        return 1;
-    }
+    bool foundAnyCurvesOrPoints = false;
+    std::vector<std::string> errors;
 
-    const std::string usdFilePath = argv[1];
-    TestRunner runner(usdFilePath);
+    // Reports a widths array whose length does not match the expected count for its interpolation
+    auto checkWidths = [&errors](const std::string& path, const pxr::UsdAttribute& widthsAttr,
+                                 const pxr::TfToken& interpolation, int64_t expected) {
+        pxr::VtFloatArray widths;
+        if (!widthsAttr.Get(&widths) || widths.empty()) {
+            return;
+        }
+        if (expected < 0) {
+            errors.push_back("Unknown widths interpolation '" + interpolation.GetString() + "' at: " + path);
+        } else if (static_cast<int64_t>(widths.size()) != expected) {
+            errors.push_back("Widths count mismatch at " + path + ": " + std::to_string(widths.size()) +
+                             " authored for '" + interpolation.GetString() + "' interpolation, expected " +
+                             std::to_string(expected));
+        }
+    };
 
-    // Add tests with their identifiers
-    runner.addTest("geometry", validateGeometry);
-    runner.addTest("shaders", validateShaders);
-    runner.addTest("layers", validateLayerStructure);
-    runner.addTest("variants", validateVariants);
+    for (auto prim : stage->Traverse()) {
+        const std::string path = prim.GetPath().GetString();
 
-    // Parse command line arguments and run tests
-    TestConfig config = parseArguments(argc, argv);
+        if (auto curves = pxr::UsdGeomBasisCurves(prim)) {
+            foundAnyCurvesOrPoints = true;
+
+            pxr::VtIntArray curveVertexCounts;
+            pxr::VtVec3fArray points;
+            pxr::TfToken type, basis, wrap;
+            curves.GetCurveVertexCountsAttr().Get(&curveVertexCounts);
+            curves.GetPointsAttr().Get(&points);
+            curves.GetTypeAttr().Get(&type);
+            curves.GetBasisAttr().Get(&basis);
+            curves.GetWrapAttr().Get(&wrap);
+
+            const int* counts = curveVertexCounts.cdata();
+            const size_t curveCount = curveVertexCounts.size();
+
+            int64_t vertexTotal = arrayKernels::parallelSum<int64_t>(curveCount, [counts](size_t begin, size_t end) {
+                return arrayKernels::sumValues(counts, begin, end);
+            });
+            if (vertexTotal != static_cast<int64_t>(points.size())) {
+                errors.push_back("curveVertexCounts sum mismatch at " + path + ": counts sum to " +
+                                 std::to_string(vertexTotal) + " but points has " +
+                                 std::to_string(points.size()) + " entries");
+            }
+
+            // Vertices consumed per segment and the minimum vertices for a single segment
+            const bool periodic = wrap == pxr::UsdGeomTokens->periodic;
+            const bool pinned = wrap == pxr::UsdGeomTokens->pinned;
+            int vstep = 1;
+            int minVertices = 2;
+            if (type == pxr::UsdGeomTokens->cubic) {
+                vstep = basis == pxr::UsdGeomTokens->bezier ? 3 : 1;
+                minVertices = periodic ? 3 : (pinned && vstep == 1 ? 2 : 4);
+            }
+            const int offset = periodic ? 0 : minVertices;
+
+            size_t invalidCurves = arrayKernels::parallelCount(curveCount, [=](size_t begin, size_t end) {
+                size_t bad = 0;
+                for (size_t i = begin; i < end; ++i) {
+                    bad += (counts[i] < minVertices) | ((counts[i] - offset) % vstep != 0);
+                }
+                return bad;
+            });
+            if (invalidCurves > 0) {
+                errors.push_back("Invalid curve vertex counts at " + path + ": " + std::to_string(invalidCurves) +
+                                 " of " + std::to_string(curveCount) + " curves are too short or do not fit " +
+                                 "whole segments for " + type.GetString() + " " +
+                                 (type == pxr::UsdGeomTokens->cubic ? basis.GetString() + " " : "") +
+                                 wrap.GetString() + " curves");
+            }
+
+            // Varying data has one value per segment end, shared between segments on periodic curves
+            int64_t varyingTotal = arrayKernels::parallelSum<int64_t>(curveCount, [=](size_t begin, size_t end) {
+                int64_t sum = 0;
+                for (size_t i = begin; i < end; ++i) {
+                    const int clamped = std::max(counts[i], minVertices);
+                    const int segments = periodic ? clamped / vstep : (clamped - minVertices) / vstep + 1;
+                    sum += segments + !periodic;
+                }
+                return sum;
+            });
+
+            const pxr::TfToken interpolation = curves.GetWidthsInterpolation();
+            int64_t expected = -1;
+            if (interpolation == pxr::UsdGeomTokens->constant) {
+                expected = 1;
+            } else if (interpolation == pxr::UsdGeomTokens->uniform) {
+                expected = static_cast<int64_t>(curveCount);
+            } else if (interpolation == pxr::UsdGeomTokens->varying ||
+                       interpolation == pxr::UsdGeomTokens->faceVarying) {
+                expected = varyingTotal;
+            } else if (interpolation == pxr::UsdGeomTokens->vertex) {
+                expected = static_cast<int64_t>(points.size());
+            }
+            checkWidths(path, curves.GetWidthsAttr(), interpolation, expected);
+        } else if (auto pointsPrim = pxr::UsdGeomPoints(prim)) {
+            foundAnyCurvesOrPoints = true;
+
+            pxr::VtVec3fArray points;
+            pointsPrim.GetPointsAttr().Get(&points);
+
+            const pxr::TfToken interpolation = pointsPrim.GetWidthsInterpolation();
+            int64_t expected = -1;
+            if (interpolation == pxr::UsdGeomTokens->constant || interpolation == pxr::UsdGeomTokens->uniform) {
+                expected = 1;
+            } else if (interpolation == pxr::UsdGeomTokens->vertex ||
+                       interpolation == pxr::UsdGeomTokens->varying ||
+                       interpolation == pxr::UsdGeomTokens->faceVarying) {
+                expected = static_cast<int64_t>(points.size());
+            }
+            checkWidths(path, pointsPrim.GetWidthsAttr(), interpolation, expected);
+        }
+    }
+
+    if (!foundAnyCurvesOrPoints) {
+        return {
+            "Validate Curves and Points",
+            true,
+            "No basis curves or points found in the scene, which is acceptable."
+        };
+    }
+
+    if (!errors.empty()) {
+        std::string errorMsg = "Curves and points validation failed with the following issues:\n";
+        for (const auto& err : errors) {
+            errorMsg += "- " + err + "\n";
+        }
+        return {"Validate Curves and Points", false, errorMsg};
+    }
+
+    return {"Validate Curves and Points", true, "All curves and points have consistent vertex counts and widths."};
+}
+
+/**
+ * @brief Validates skinning bindings and joint influences on every skinned prim in a USD file.
+ *
+ * A prim is considered skinned when it authors `primvars:skel:jointIndices`. For each one, checks:
+ * - jointIndices fall within the joint count of the bound skeleton (or the prim's `skel:joints`).
+ * - jointIndices and jointWeights share an elementSize consistent with their lengths.
+ * - jointWeights are non-negative and sum to 1 per point within tolerance.
+ * - geomBindTransform, when authored, is invertible.
+ *
+ * Skinned prims are validated in parallel, and the per-point reductions within each prim are
+ * vectorizable kernels.
+ *
+ * @param stage The USD stage to validate.
+ * @return TestResult Containing:
+ *         - Test name ("Validate Skinning").
+ *         - Success/failure status.
+ *         - Detailed validation results or errors.
+ */
+TestResult validateSkinning(const pxr::UsdStageRefPtr& stage) {
+    if (!stage) {
+        return {"Validate Skinning", false, "Invalid stage reference."};
+    }
+
+    // Allowed deviation of each point's weight sum from 1
+    static constexpr float kWeightSumTolerance = 1e-3f;
+    // Determinants smaller than this are treated as singular
+    static constexpr double kSingularDeterminant = 1e-12;
+
+    std::vector<pxr::UsdPrim> skinnedPrims;
+    for (auto prim : stage->Traverse()) {
+        if (pxr::UsdSkelBindingAPI(prim).GetJointIndicesAttr().HasAuthoredValue()) {
+            skinnedPrims.push_back(prim);
+        }
+    }
+
+    if (skinnedPrims.empty()) {
+        return {
+            "Validate Skinning",
+            true,
+            "No skinned prims found in the scene, which is acceptable."
+        };
+    }
+
+    // Each prim writes only its own slot, keeping the report in traversal order
+    std::vector<std::vector<std::string>> primErrors(skinnedPrims.size());
+
+    pxr::WorkParallelForN(skinnedPrims.size(), [&](size_t first, size_t last) {
+        for (size_t p = first; p < last; ++p) {
+            const pxr::UsdPrim& prim = skinnedPrims[p];
+            std::vector<std::string>& errors = primErrors[p];
+            const std::string path = prim.GetPath().GetString();
+            pxr::UsdSkelBindingAPI binding(prim);
+
+            // A joints override on the prim takes precedence over the skeleton's joint order
+            pxr::VtTokenArray joints;
+            if (!binding.GetJointsAttr().Get(&joints)) {
+                pxr::UsdSkelSkeleton skeleton = binding.GetInheritedSkeleton();
+                if (!skeleton) {
+                    errors.push_back("No skeleton bound to skinned prim: " + path);
+                    continue;
+                }
+                skeleton.GetJointsAttr().Get(&joints);
+            }
+            const size_t jointCount = joints.size();
+
+            pxr::UsdGeomPrimvar indicesPrimvar = binding.GetJointIndicesPrimvar();
+            pxr::UsdGeomPrimvar weightsPrimvar = binding.GetJointWeightsPrimvar();
+            pxr::VtIntArray jointIndices;
+            pxr::VtFloatArray jointWeights;
+            indicesPrimvar.Get(&jointIndices);
+            weightsPrimvar.Get(&jointWeights);
+
+            const int* indexData = jointIndices.cdata();
+            size_t badIndices = arrayKernels::parallelCount(jointIndices.size(), [=](size_t begin, size_t end) {
+                return arrayKernels::countOutOfRange(indexData, begin, end, jointCount);
+            });
+            if (badIndices > 0) {
+                errors.push_back("Out of range jointIndices at " + path + ": " + std::to_string(badIndices) +
+                                 " of " + std::to_string(jointIndices.size()) + " outside [0, " +
+                                 std::to_string(jointCount) + ")");
+            }
+
+            const int elementSize = indicesPrimvar.GetElementSize();
+            if (weightsPrimvar.GetElementSize() != elementSize) {
+                errors.push_back("jointIndices/jointWeights elementSize mismatch at " + path + ": " +
+                                 std::to_string(elementSize) + " vs " +
+                                 std::to_string(weightsPrimvar.GetElementSize()));
+                continue;
+            }
+
+            // Influences are either shared by the whole prim (constant) or given per point
+            size_t influencedPoints = 1;
+            if (indicesPrimvar.GetInterpolation() != pxr::UsdGeomTokens->constant) {
+                pxr::VtVec3fArray points;
+                pxr::UsdGeomPointBased(prim).GetPointsAttr().Get(&points);
+                influencedPoints = points.size();
+            }
+            const size_t expected = influencedPoints * static_cast<size_t>(elementSize);
+            for (const auto& [name, size] : {std::make_pair(std::string("jointIndices"), jointIndices.size()),
+                                             std::make_pair(std::string("jointWeights"), jointWeights.size())}) {
+                if (size != expected) {
+                    errors.push_back("Skinning array length mismatch at " + path + ": " + name + " has " +
+                                     std::to_string(size) + " entries, expected " + std::to_string(expected) +
+                                     " (elementSize " + std::to_string(elementSize) + " x " +
+                                     std::to_string(influencedPoints) + " points)");
+                }
+            }
+
+            const float* weightData = jointWeights.cdata();
+            size_t negativeWeights = arrayKernels::parallelCount(jointWeights.size(), [=](size_t begin, size_t end) {
+                size_t bad = 0;
+                for (size_t i = begin; i < end; ++i) {
+                    bad += weightData[i] < 0.0f;
+                }
+                return bad;
+            });
+            if (negativeWeights > 0) {
+                errors.push_back("Negative jointWeights at " + path + ": " + std::to_string(negativeWeights) +
+                                 " of " + std::to_string(jointWeights.size()));
+            }
+
+            const size_t weightedPoints = elementSize > 0 ? jointWeights.size() / elementSize : 0;
+            size_t unnormalized = arrayKernels::parallelCount(weightedPoints, [=](size_t begin, size_t end) {
+                size_t bad = 0;
+                for (size_t i = begin; i < end; ++i) {
+                    float sum = 0.0f;
+                    for (int k = 0; k < elementSize; ++k) {
+                        sum += weightData[i * elementSize + k];
+                    }
+                    bad += !(std::fabs(sum - 1.0f) <= kWeightSumTolerance);
+                }
+                return bad;
+            });
+            if (unnormalized > 0) {
+                errors.push_back("Unnormalized jointWeights at " + path + ": " + std::to_string(unnormalized) +
+                                 " of " + std::to_string(weightedPoints) + " points (" +
+                                 formatPercent(unnormalized, weightedPoints) + ") do not sum to 1");
+            }
+
+            pxr::GfMatrix4d geomBindTransform;
+            if (binding.GetGeomBindTransformAttr().Get(&geomBindTransform) &&
+                !(std::fabs(geomBindTransform.GetDeterminant()) > kSingularDeterminant)) {
+                errors.push_back("Non-invertible geomBindTransform at: " + path);
+            }
+        }
+    });
+
+    std::vector<std::string> errors;
+    for (const auto& messages : primErrors) {
+        errors.insert(errors.end(), messages.begin(), messages.end());
+    }
+
+    if (!errors.empty()) {
+        std::string errorMsg = "Skinning validation failed with the following issues:\n";
+        for (const auto& err : errors) {
+            errorMsg += "- " + err + "\n";
+        }
+        return {"Validate Skinning", false, errorMsg};
+    }
+
+    return {"Validate Skinning", true, "All skinned prims have valid joint influences and bind transforms."};
+}
+
+/**
+ * @struct ModelHierarchy
+ * @brief Prims in traversal order, each tagged with its parent and the nearest model that encloses it.
+ */
+struct ModelHierarchy {
+    std::vector<pxr::UsdPrim> prims;
+    std::vector<int> primParents;      // Index into prims of each prim's parent, or -1 for root prims
+    std::vector<int> primModels;       // Index into models of each prim's nearest model, or -1
+    std::vector<pxr::UsdPrim> models;  // In traversal order, so parents precede children
+    std::vector<int> modelParents;     // Index of each model's enclosing model, or -1
+};
+
+/**
+ * @brief Records the prims of a range and attributes each one to its nearest enclosing model.
+ * @param range A depth-first prim range, typically stage->Traverse().
+ * @return ModelHierarchy The prims and models of the range.
+ */
+ModelHierarchy collectModelHierarchy(const pxr::UsdPrimRange& range) {
+    ModelHierarchy hierarchy;
+    std::vector<int> primStack;
+    std::vector<int> modelStack;
+
+    for (auto prim : range) {
+        // Traversal is depth first, so leaving a subtree means its root is no longer an ancestor
+        const pxr::SdfPath& path = prim.GetPath();
+        while (!primStack.empty() && !path.HasPrefix(hierarchy.prims[primStack.back()].GetPath())) {
+            primStack.pop_back();
+        }
+        while (!modelStack.empty() && !path.HasPrefix(hierarchy.models[modelStack.back()].GetPath())) {
+            modelStack.pop_back();
+        }
+
+        if (prim.IsModel()) {
+            hierarchy.models.push_back(prim);
+            hierarchy.modelParents.push_back(modelStack.empty() ? -1 : modelStack.back());
+            modelStack.push_back(static_cast<int>(hierarchy.models.size()) - 1);
+        }
+
+        hierarchy.prims.push_back(prim);
+        hierarchy.primParents.push_back(primStack.empty() ? -1 : primStack.back());
+        hierarchy.primModels.push_back(modelStack.empty() ? -1 : modelStack.back());
+        primStack.push_back(static_cast<int>(hierarchy.prims.size()) - 1);
+    }
+
+    return hierarchy;
+}
+
+/**
+ * @struct ModelHierarchyCache
+ * @brief The model hierarchy of a stage, collected on first use and shared by every test of a run.
+ *
+ * The census, the memory estimates and the hierarchy checks all walk the same prims, so the
+ * runner owns one cache and the stage is traversed once however many of them are enabled. The
+ * hierarchy is recollected if a different stage is passed in.
+ */
+struct ModelHierarchyCache {
+    pxr::UsdStageRefPtr stage;  // Stage the hierarchy was collected from
+    ModelHierarchy hierarchy;
+
+    // Returns the model hierarchy of a stage, traversing it on first use
+    const ModelHierarchy& get(const pxr::UsdStageRefPtr& usdStage) {
+        if (stage != usdStage) {
+            hierarchy = collectModelHierarchy(usdStage->Traverse());
+            stage = usdStage;
+        }
+        return hierarchy;
+    }
+};
+
+/**
+ * @brief Rolls per-model counts up the model hierarchy.
+ * @param modelParents Index of each model's enclosing model, or -1, with parents preceding children.
+ * @param ownCounts Counts attributed directly to each model.
+ * @return Each model's own counts plus those of all its descendant models.
+ */
+template <typename Counts>
+std::vector<Counts> rollUpModels(const std::vector<int>& modelParents, const std::vector<Counts>& ownCounts) {
+    std::vector<Counts> rolledUp = ownCounts;
+    // Children follow their parents, so a reverse sweep has finished each child before its parent
+    for (size_t i = rolledUp.size(); i-- > 0;) {
+        if (modelParents[i] >= 0) {
+            rolledUp[modelParents[i]] += rolledUp[i];
+        }
+    }
+    return rolledUp;
+}
+
+/**
+ * @brief Names the leaf models that contribute most to a budget overrun, so it can be traced back to assets.
+ * @param modelParents Index of each model's enclosing model, or -1.
+ * @param amounts Rolled-up amount of each model.
+ * @return Indices of up to three leaf models with a non-zero amount, largest first.
+ */
+std::vector<size_t> largestLeafModels(const std::vector<int>& modelParents, const std::vector<uint64_t>& amounts) {
+    constexpr size_t kMaxContributors = 3;
+
+    std::vector<bool> hasChildModels(modelParents.size(), false);
+    for (int parent : modelParents) {
+        if (parent >= 0) {
+            hasChildModels[parent] = true;
+        }
+    }
+    std::vector<size_t> leaves;
+    for (size_t i = 0; i < modelParents.size(); ++i) {
+        if (!hasChildModels[i] && amounts[i] > 0) {
+            leaves.push_back(i);
+        }
+    }
+    std::stable_sort(leaves.begin(), leaves.end(), [&amounts](size_t a, size_t b) {
+        return amounts[a] > amounts[b];
+    });
+    if (leaves.size() > kMaxContributors) {
+        leaves.resize(kMaxContributors);
+    }
+    return leaves;
+}
+
+/**
+ * @struct CensusCounts
+ * @brief Prim, topology and primvar totals accumulated by the scene census.
+ */
+struct CensusCounts {
+    size_t prims = 0;
+    size_t faces = 0;
+    size_t vertices = 0;
+    size_t primvarBytes = 0;
+    size_t materials = 0;
+
+    CensusCounts& operator+=(const CensusCounts& other) {
+        prims += other.prims;
+        faces += other.faces;
+        vertices += other.vertices;
+        primvarBytes += other.primvarBytes;
+        materials += other.materials;
+        return *this;
+    }
+};
+
+/**
+ * @struct CensusModel
+ * @brief A model prim found by the census along with the counts attributed to it.
+ *
+ * @var ownCounts
+ * Counts of the prims whose nearest enclosing model is this one (including the model itself).
+ *
+ * @var rolledUpCounts
+ * Own counts plus the rolled-up counts of every descendant model.
+ */
+struct CensusModel {
+    pxr::SdfPath path;
+    pxr::TfToken kind;
+    int parent = -1;  // Index of the enclosing model, or -1 for top-level models
+    CensusCounts ownCounts;
+    CensusCounts rolledUpCounts;
+};
+
+/**
+ * @struct SceneCensus
+ * @brief One-pass census of a stage, broken down by prim type and rolled up by model.
+ */
+struct SceneCensus {
+    CensusCounts totals;
+    std::map<std::string, CensusCounts> byType;  // Keyed by type name, "(untyped)" for typeless prims
+    std::vector<CensusModel> models;             // In traversal order, so parents precede children
+};
+
+/**
+ * @brief Returns the number of elements in an attribute's value, 1 for scalars and 0 if unset.
+ *
+ * USD has no public query for the size of an array without fetching it, so the value at the
+ * earliest time is read in full to learn its array size. Arrays in crate files are read and,
+ * when compressed, decompressed like any other Get.
+ */
+size_t attributeElementCount(const pxr::UsdAttribute& attr) {
+    pxr::VtValue value;
+    if (!attr.Get(&value, pxr::UsdTimeCode::EarliestTime())) {
+        return 0;
+    }
+    return value.IsArrayValued() ? value.GetArraySize() : 1;
+}
+
+/**
+ * @brief Returns the bytes held by an attribute's value, from its value type and array size.
+ *
+ * The value is read through attributeElementCount(); only the element type's size is used.
+ */
+size_t attributeValueBytes(const pxr::UsdAttribute& attr) {
+    return attributeElementCount(attr) * attr.GetTypeName().GetScalarType().GetType().GetSizeof();
+}
+
+/**
+ * @brief Returns the bytes held by an authored primvar's value and indices.
+ */
+size_t primvarByteSize(const pxr::UsdGeomPrimvar& primvar) {
+    size_t bytes = attributeValueBytes(primvar.GetAttr());
+    if (primvar.IsIndexed()) {
+        bytes += attributeValueBytes(primvar.GetIndicesAttr());
+    }
+    return bytes;
+}
+
+/**
+ * @struct PrimSizes
+ * @brief Array sizes of a single prim, read once per run and shared by the tests that need them.
+ */
+struct PrimSizes {
+    size_t faces = 0;            // Entries of a mesh's faceVertexCounts
+    size_t vertices = 0;         // Entries of a point-based prim's points
+    size_t instances = 0;        // Entries of a point instancer's protoIndices
+    uint64_t primvarBytes = 0;   // Authored primvar values and indices
+    uint64_t geometryBytes = 0;  // Array-valued attributes of a boundable prim, excluding primvars
+};
+
+/**
+ * @brief Reads the array sizes of a single prim, reading each array once.
+ */
+PrimSizes measurePrim(const pxr::UsdPrim& prim) {
+    PrimSizes sizes;
+    for (const auto& primvar : pxr::UsdGeomPrimvarsAPI(prim).GetAuthoredPrimvars()) {
+        sizes.primvarBytes += primvarByteSize(primvar);
+    }
+
+    if (!prim.IsA<pxr::UsdGeomBoundable>()) {
+        return sizes;
+    }
+
+    // Face, vertex and instance counts are taken from the same reads as the geometry bytes
+    const bool isMesh = prim.IsA<pxr::UsdGeomMesh>();
+    const bool isPointBased = prim.IsA<pxr::UsdGeomPointBased>();
+    const bool isInstancer = prim.IsA<pxr::UsdGeomPointInstancer>();
+    for (const auto& attr : prim.GetAuthoredAttributes()) {
+        const pxr::TfToken& name = attr.GetName();
+        if (!attr.GetTypeName().IsArray() || name.GetString().compare(0, 9, "primvars:") == 0) {
+            continue;
+        }
+        const size_t count = attributeElementCount(attr);
+        sizes.geometryBytes += count * attr.GetTypeName().GetScalarType().GetType().GetSizeof();
+        if (isMesh && name == pxr::UsdGeomTokens->faceVertexCounts) {
+            sizes.faces = count;
+        } else if (isPointBased && name == pxr::UsdGeomTokens->points) {
+            sizes.vertices = count;
+        } else if (isInstancer && name == pxr::UsdGeomTokens->protoIndices) {
+            sizes.instances = count;
+        }
+    }
+
+    return sizes;
+}
+
+/**
+ * @struct PrimSizeCache
+ * @brief Array sizes of every prim of a stage's model hierarchy, read on first use.
+ *
+ * Sizes are read in parallel and indexed like ModelHierarchy::prims. They are read again if a
+ * different stage is passed in.
+ */
+struct PrimSizeCache {
+    pxr::UsdStageRefPtr stage;  // Stage the sizes were read from
+    std::vector<PrimSizes> sizes;
+
+    // Returns the sizes of the hierarchy's prims, reading them on first use
+    const std::vector<PrimSizes>& get(const pxr::UsdStageRefPtr& usdStage, const ModelHierarchy& hierarchy) {
+        if (stage != usdStage) {
+            sizes.assign(hierarchy.prims.size(), PrimSizes());
+            pxr::WorkParallelForN(hierarchy.prims.size(), [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    sizes[i] = measurePrim(hierarchy.prims[i]);
+                }
+            });
+            stage = usdStage;
+        }
+        return sizes;
+    }
+};
+
+/**
+ * @brief Counts the contribution of a single prim to the census.
+ */
+CensusCounts countPrim(const pxr::UsdPrim& prim, const PrimSizes& sizes) {
+    CensusCounts counts;
+    counts.prims = 1;
+    counts.faces = sizes.faces;
+    counts.vertices = sizes.vertices;
+    counts.primvarBytes = sizes.primvarBytes;
+    if (prim.IsA<pxr::UsdShadeMaterial>()) {
+        counts.materials = 1;
+    }
+    return counts;
+}
+
+/**
+ * @brief Takes a census of every prim of a model hierarchy.
+ *
+ * The hierarchy only records prims and their nearest enclosing model, and the array sizes come
+ * from the run's shared size pass. Counting then runs in parallel over the recorded prims, with
+ * each worker accumulating into thread-local counters that are merged once all prims have been
+ * visited.
+ *
+ * @param hierarchy The prims and models of the stage to survey.
+ * @param sizes The array sizes of the hierarchy's prims.
+ * @return SceneCensus Totals by prim type and by model, with model counts rolled up.
+ */
+SceneCensus takeSceneCensus(const ModelHierarchy& hierarchy, const std::vector<PrimSizes>& sizes) {
+    SceneCensus census;
+    const std::vector<pxr::UsdPrim>& prims = hierarchy.prims;
+    const std::vector<int>& primModels = hierarchy.primModels;
+
+    for (size_t i = 0; i < hierarchy.models.size(); ++i) {
+        CensusModel model;
+        model.path = hierarchy.models[i].GetPath();
+        pxr::UsdModelAPI(hierarchy.models[i]).GetKind(&model.kind);
+        model.parent = hierarchy.modelParents[i];
+        census.models.push_back(model);
+    }
+
+    struct Accumulator {
+        std::map<std::string, CensusCounts> byType;
+        std::vector<CensusCounts> modelCounts;
+    };
+    Accumulator exemplar;
+    exemplar.modelCounts.resize(census.models.size());
+    tbb::enumerable_thread_specific<Accumulator> accumulators(exemplar);
+
+    pxr::WorkParallelForN(prims.size(), [&](size_t begin, size_t end) {
+        Accumulator& local = accumulators.local();
+        for (size_t i = begin; i < end; ++i) {
+            const pxr::TfToken& typeName = prims[i].GetTypeName();
+            CensusCounts counts = countPrim(prims[i], sizes[i]);
+            local.byType[typeName.IsEmpty() ? "(untyped)" : typeName.GetString()] += counts;
+            if (primModels[i] >= 0) {
+                local.modelCounts[primModels[i]] += counts;
+            }
+        }
+    });
+
+    accumulators.combine_each([&census](const Accumulator& local) {
+        for (const auto& [type, counts] : local.byType) {
+            census.byType[type] += counts;
+            census.totals += counts;
+        }
+        for (size_t i = 0; i < local.modelCounts.size(); ++i) {
+            census.models[i].ownCounts += local.modelCounts[i];
+        }
+    });
+
+    std::vector<CensusCounts> ownCounts;
+    for (const auto& model : census.models) {
+        ownCounts.push_back(model.ownCounts);
+    }
+    const std::vector<CensusCounts> rolledUp = rollUpModels(hierarchy.modelParents, ownCounts);
+    for (size_t i = 0; i < census.models.size(); ++i) {
+        census.models[i].rolledUpCounts = rolledUp[i];
+    }
+
+    return census;
+}
+
+/**
+ * @brief Formats census counts as a comma separated list.
+ */
+std::string describeCounts(const CensusCounts& counts) {
+    return std::to_string(counts.prims) + " prims, " +
+           std::to_string(counts.faces) + " faces, " +
+           std::to_string(counts.vertices) + " vertices, " +
+           std::to_string(counts.primvarBytes) + " primvar bytes, " +
+           std::to_string(counts.materials) + " materials";
+}
+
+/**
+ * @brief Reports scene statistics and enforces the geometry budgets configured in TestConfig.
+ *
+ * Takes a one-pass census of the stage that counts prims, mesh faces, points, authored primvar
+ * bytes and materials per prim type, attributing each prim to its nearest model so counts can
+ * be rolled up the model (kind) hierarchy.
+ *
+ * Any scene total above its configured budget fails the test, naming the leaf models that
+ * contribute most to the overrun. Budgets left at 0 are not enforced.
+ *
+ * @param stage The USD stage to validate.
+ * @param config The configuration holding the budgets.
+ * @param hierarchies The run's model hierarchy cache, so the stage is traversed once per run.
+ * @param sizes The run's array size cache, so each array is read once per run.
+ * @return TestResult Containing:
+ *         - Test name ("Validate Scene Statistics").
+ *         - Success/failure status.
+ *         - Census breakdown or budget overruns.
+ */
+TestResult validateSceneStatistics(const pxr::UsdStageRefPtr& stage, const TestConfig& config,
+                                   ModelHierarchyCache& hierarchies, PrimSizeCache& sizes) {
+    if (!stage) {
+        return {"Validate Scene Statistics", false, "Invalid stage reference."};
+    }
+
+    const ModelHierarchy& hierarchy = hierarchies.get(stage);
+    const SceneCensus census = takeSceneCensus(hierarchy, sizes.get(stage, hierarchy));
+
+    struct Budget {
+        std::string label;
+        size_t CensusCounts::*count;
+        size_t limit;
+    };
+    const std::vector<Budget> budgets = {
+        {"prims", &CensusCounts::prims, config.maxPrims},
+        {"faces", &CensusCounts::faces, config.maxFaces},
+        {"vertices", &CensusCounts::vertices, config.maxVertices},
+        {"primvar bytes", &CensusCounts::primvarBytes, config.maxPrimvarBytes},
+        {"materials", &CensusCounts::materials, config.maxMaterials},
+    };
+
+    std::vector<std::string> errors;
+    for (const auto& budget : budgets) {
+        const size_t total = census.totals.*budget.count;
+        if (budget.limit == 0 || total <= budget.limit) {
+            continue;
+        }
+
+        std::string error = "Scene has " + std::to_string(total) + " " + budget.label +
+                            ", over the budget of " + std::to_string(budget.limit);
+
+        std::vector<uint64_t> amounts;
+        for (const auto& model : census.models) {
+            amounts.push_back(model.rolledUpCounts.*budget.count);
+        }
+        const std::vector<size_t> leaves = largestLeafModels(hierarchy.modelParents, amounts);
+        for (size_t i = 0; i < leaves.size(); ++i) {
+            error += (i == 0 ? "; largest models: " : ", ") + census.models[leaves[i]].path.GetString() +
+                     " (" + std::to_string(amounts[leaves[i]]) + ")";
+        }
+        errors.push_back(error);
+    }
+
+    if (!errors.empty()) {
+        std::string errorMsg = "Scene statistics exceeded the configured budgets:\n";
+        for (const auto& err : errors) {
+            errorMsg += "- " + err + "\n";
+        }
+        return {"Validate Scene Statistics", false, errorMsg};
+    }
+
+    std::string message = "Scene is within all configured budgets: " + describeCounts(census.totals) + ".";
+    if (census.totals.prims > 0) {
+        message += "\n";
+        for (const auto& [type, counts] : census.byType) {
+            message += "- Type " + type + ": " + describeCounts(counts) + "\n";
+        }
+
+        // Roll up by kind, counting each prim once under its nearest model
+        std::map<std::string, std::pair<size_t, CensusCounts>> byKind;
+        for (const auto& model : census.models) {
+            auto& [modelCount, counts] = byKind[model.kind.IsEmpty() ? "(no kind)" : model.kind.GetString()];
+            ++modelCount;
+            counts += model.ownCounts;
+        }
+        for (const auto& [kind, entry] : byKind) {
+            message += "- Kind '" + kind + "': " + std::to_string(entry.first) + " models, " +
+                       describeCounts(entry.second) + "\n";
+        }
+    }
+
+    return {"Validate Scene Statistics", true, message};
+}
+
+/**
+ * @struct ShaderTextureUse
+ * @brief A shader input naming a texture file and the path it resolves to.
+ */
+struct ShaderTextureUse {
+    pxr::UsdPrim shader;
+    pxr::TfToken inputName;
+    std::string assetPath;
+    std::string resolvedPath;  // Empty if the asset could not be resolved
+};
+
+/**
+ * @brief Returns true for a string-typed shader input named "file" or "filename".
+ *
+ * Older exporters and some renderer shading nodes author texture paths as plain strings under
+ * these names, so they are treated as texture paths alongside asset-valued inputs.
+ */
+bool isStringTextureInput(const pxr::UsdAttribute& attr) {
+    static const pxr::TfToken kFile("file");
+    static const pxr::TfToken kFilename("filename");
+    if (attr.GetTypeName() != pxr::SdfValueTypeNames->String || !pxr::UsdShadeInput::IsInput(attr)) {
+        return false;
+    }
+    const pxr::TfToken name = pxr::UsdShadeInput(attr).GetBaseName();
+    return name == kFile || name == kFilename;
+}
+
+/**
+ * @brief Resolves a path authored as a plain string the way USD resolves asset values.
+ *
+ * The path is anchored to the layer holding the strongest default value of the attribute, then
+ * resolved by the asset resolver, which the caller must have bound to the stage's context.
+ *
+ * @return The resolved path, or an empty string if it does not resolve.
+ */
+std::string resolveStringAssetPath(const pxr::UsdAttribute& attr, const std::string& assetPath) {
+    for (const auto& spec : attr.GetPropertyStack(pxr::UsdTimeCode::Default())) {
+        if (spec->HasDefaultValue()) {
+            return pxr::ArGetResolver()
+                .Resolve(pxr::SdfComputeAssetPathRelativeToLayer(spec->GetLayer(), assetPath))
+                .GetPathString();
+        }
+    }
+    return pxr::ArGetResolver().Resolve(assetPath).GetPathString();
+}
+
+/**
+ * @brief Collects every authored texture path input on the shaders among the given prims.
+ *
+ * Covers asset-valued inputs and string inputs accepted by isStringTextureInput(). Asset paths
+ * are resolved as their values are read, and string paths are resolved by hand against the
+ * stage's resolver context, so the prims are read in parallel and the whole set resolves
+ * concurrently. Uses are returned in the order of the given prims.
+ */
+std::vector<ShaderTextureUse> collectShaderTextures(const std::vector<pxr::UsdPrim>& prims) {
+    std::vector<std::vector<ShaderTextureUse>> primUses(prims.size());
+    pxr::WorkParallelForN(prims.size(), [&](size_t first, size_t last) {
+        // The resolver context is bound per thread, so each worker binds the stage's own
+        const pxr::ArResolverContextBinder binder(prims[first].GetStage()->GetPathResolverContext());
+        for (size_t p = first; p < last; ++p) {
+            pxr::UsdShadeShader shader(prims[p]);
+            if (!shader) {
+                continue;
+            }
+            for (const auto& input : shader.GetInputs()) {
+                if (input.GetTypeName() == pxr::SdfValueTypeNames->Asset) {
+                    pxr::SdfAssetPath asset;
+                    if (!input.Get(&asset) || asset.GetAssetPath().empty()) {
+                        continue;
+                    }
+                    primUses[p].push_back({prims[p], input.GetBaseName(), asset.GetAssetPath(), asset.GetResolvedPath()});
+                } else if (isStringTextureInput(input.GetAttr())) {
+                    std::string path;
+                    if (!input.Get(&path) || path.empty()) {
+                        continue;
+                    }
+                    primUses[p].push_back({prims[p], input.GetBaseName(), path,
+                                           resolveStringAssetPath(input.GetAttr(), path)});
+                }
+            }
+        }
+    });
+
+    std::vector<ShaderTextureUse> uses;
+    for (auto& used : primUses) {
+        uses.insert(uses.end(), std::make_move_iterator(used.begin()), std::make_move_iterator(used.end()));
+    }
+    return uses;
+}
+
+/**
+ * @brief Formats a byte count with a binary unit suffix.
+ */
+std::string formatBytes(uint64_t bytes) {
+    static const char* const kUnits[] = {"B", "KB", "MB", "GB", "TB"};
+    if (bytes < 1024) {
+        return std::to_string(bytes) + " B";
+    }
+    double value = static_cast<double>(bytes);
+    size_t unit = 0;
+    while (value >= 1024.0 && unit + 1 < sizeof(kUnits) / sizeof(kUnits[0])) {
+        value /= 1024.0;
+        ++unit;
+    }
+    std::ostringstream stream;
+    stream << std::fixed << std::setprecision(1) << value << " " << kUnits[unit];
+    return stream.str();
+}
+
+/**
+ * @struct MemoryBytes
+ * @brief Estimated render memory, broken down by where it comes from.
+ */
+struct MemoryBytes {
+    uint64_t geometry = 0;    // Array-valued attributes on boundable prims, excluding primvars
+    uint64_t primvars = 0;    // Authored primvar values and indices
+    uint64_t prototypes = 0;  // Geometry and primvars of native instancing prototypes, stored once
+    uint64_t instances = 0;   // Per-instance transforms for native instances and point instancers
+    uint64_t textures = 0;    // Uncompressed full mip chain of each unique texture
+
+    uint64_t total() const {
+        return geometry + primvars + prototypes + instances + textures;
+    }
+
+    MemoryBytes& operator+=(const MemoryBytes& other) {
+        geometry += other.geometry;
+        primvars += other.primvars;
+        prototypes += other.prototypes;
+        instances += other.instances;
+        textures += other.textures;
+        return *this;
+    }
+};
+
+/**
+ * @brief Formats a memory breakdown as a comma separated list.
+ */
+std::string describeMemory(const MemoryBytes& bytes) {
+    return formatBytes(bytes.geometry) + " geometry arrays, " +
+           formatBytes(bytes.primvars) + " primvars, " +
+           formatBytes(bytes.prototypes) + " instancing prototypes, " +
+           formatBytes(bytes.instances) + " per-instance transforms, " +
+           formatBytes(bytes.textures) + " textures";
+}
+
+/**
+ * @brief Estimates the geometry, primvar and per-instance memory of a single prim from its array sizes.
+ */
+MemoryBytes estimatePrimMemory(const pxr::UsdPrim& prim, const PrimSizes& sizes) {
+    // Renderers keep one single-precision 4x4 matrix per instance
+    constexpr uint64_t kInstanceTransformBytes = 16 * sizeof(float);
+
+    MemoryBytes bytes;
+    bytes.geometry = sizes.geometryBytes;
+    bytes.primvars = sizes.primvarBytes;
+    bytes.instances = ((prim.IsInstance() ? 1 : 0) + sizes.instances) * kInstanceTransformBytes;
+    return bytes;
+}
+
+/**
+ * @brief Estimates the render memory of the fully loaded scene and checks it against the budget.
+ *
+ * The estimate is derived from attribute value types and array sizes, and from texture image
+ * headers without decoding pixels. Array sizes come from the run's shared PrimSizeCache, so
+ * arrays already read by the census are not read again; only prototype prims, which the
+ * traversal does not visit, are measured here. It covers:
+ * - Geometry arrays on boundable prims and authored primvars.
+ * - Native instancing prototypes, counted once no matter how many instances share them, plus
+ *   one transform per native instance and per point instancer instance.
+ * - Textures referenced by shader texture path inputs, counted once per resolved file with
+ *   their full mip chain, as in validateTextureMemory().
+ *
+ * Memory is attributed to the nearest enclosing model and rolled up the model hierarchy.
+ * Fails when the total exceeds TestConfig::maxMemoryBytes (0 means unlimited).
+ *
+ * @param stage The USD stage to validate.
+ * @param config The configuration holding the memory budget.
+ * @param hierarchies The run's model hierarchy cache, so the stage is traversed once per run.
+ * @param sizes The run's array size cache, so each array is read once per run.
+ * @return TestResult Containing:
+ *         - Test name ("Validate Render Memory").
+ *         - Success/failure status.
+ *         - Memory breakdown or budget overrun details.
+ */
+TestResult validateRenderMemory(const pxr::UsdStageRefPtr& stage, const TestConfig& config,
+                                ModelHierarchyCache& hierarchies, PrimSizeCache& sizes) {
+    if (!stage) {
+        return {"Validate Render Memory", false, "Invalid stage reference."};
+    }
+
+    const ModelHierarchy& hierarchy = hierarchies.get(stage);
+    const std::vector<PrimSizes>& primSizes = sizes.get(stage, hierarchy);
+    const size_t modelCount = hierarchy.models.size();
+
+    struct Accumulator {
+        MemoryBytes totals;
+        std::vector<MemoryBytes> modelBytes;
+    };
+    Accumulator exemplar;
+    exemplar.modelBytes.resize(modelCount);
+    tbb::enumerable_thread_specific<Accumulator> accumulators(exemplar);
+
+    pxr::WorkParallelForN(hierarchy.prims.size(), [&](size_t begin, size_t end) {
+        Accumulator& local = accumulators.local();
+        for (size_t i = begin; i < end; ++i) {
+            MemoryBytes bytes = estimatePrimMemory(hierarchy.prims[i], primSizes[i]);
+            local.totals += bytes;
+            if (hierarchy.primModels[i] >= 0) {
+                local.modelBytes[hierarchy.primModels[i]] += bytes;
+            }
+        }
+    });
+
+    MemoryBytes totals;
+    std::vector<MemoryBytes> modelBytes(modelCount);
+    accumulators.combine_each([&](const Accumulator& local) {
+        totals += local.totals;
+        for (size_t i = 0; i < modelCount; ++i) {
+            modelBytes[i] += local.modelBytes[i];
+        }
+    });
+
+    // Prototypes are not visited by the default traversal, and each is stored once
+    std::vector<pxr::UsdPrim> prototypePrims;
+    for (const auto& prototype : stage->GetPrototypes()) {
+        for (auto prim : pxr::UsdPrimRange(prototype)) {
+            prototypePrims.push_back(prim);
+            MemoryBytes bytes = estimatePrimMemory(prim, measurePrim(prim));
+            totals.prototypes += bytes.geometry + bytes.primvars;
+            totals.instances += bytes.instances;
+        }
+    }
+
+    // Each resolved texture is probed once and charged to the model of its first user
+    std::vector<ShaderTextureUse> textureUses = collectShaderTextures(hierarchy.prims);
+    const std::vector<ShaderTextureUse> prototypeUses = collectShaderTextures(prototypePrims);
+    textureUses.insert(textureUses.end(), prototypeUses.begin(), prototypeUses.end());
+
+    std::unordered_map<std::string, int> textureOwners;  // Resolved path -> model index, or -1
+    std::vector<std::string> texturePaths;
+    std::unordered_map<pxr::SdfPath, int, pxr::SdfPath::Hash> modelOfPrim;
+    for (size_t i = 0; i < hierarchy.prims.size(); ++i) {
+        modelOfPrim[hierarchy.prims[i].GetPath()] = hierarchy.primModels[i];
+    }
+    for (const auto& use : textureUses) {
+        if (use.resolvedPath.empty() || textureOwners.count(use.resolvedPath)) {
+            continue;
+        }
+        auto owner = modelOfPrim.find(use.shader.GetPath());
+        textureOwners[use.resolvedPath] = owner != modelOfPrim.end() ? owner->second : -1;
+        texturePaths.push_back(use.resolvedPath);
+    }
+
+    std::vector<uint64_t> textureBytes(texturePaths.size(), 0);
+    pxr::WorkParallelForN(texturePaths.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            textureBytes[i] = readImageHeader(texturePaths[i]).mipChainByteSize();
+        }
+    });
+    for (size_t i = 0; i < texturePaths.size(); ++i) {
+        totals.textures += textureBytes[i];
+        const int owner = textureOwners[texturePaths[i]];
+        if (owner >= 0) {
+            modelBytes[owner].textures += textureBytes[i];
+        }
+    }
+
+    const std::vector<MemoryBytes> rolledUp = rollUpModels(hierarchy.modelParents, modelBytes);
+
+    if (config.maxMemoryBytes > 0 && totals.total() > config.maxMemoryBytes) {
+        std::vector<std::string> errors;
+        errors.push_back("Estimated render memory of " + formatBytes(totals.total()) +
+                         " exceeds the budget of " + formatBytes(config.maxMemoryBytes) +
+                         " (" + describeMemory(totals) + ")");
+
+        std::vector<uint64_t> amounts;
+        for (const auto& bytes : rolledUp) {
+            amounts.push_back(bytes.total());
+        }
+        const std::vector<size_t> leaves = largestLeafModels(hierarchy.modelParents, amounts);
+        std::string largest;
+        for (size_t i = 0; i < leaves.size(); ++i) {
+            largest += (i == 0 ? "Largest models: " : ", ") + hierarchy.models[leaves[i]].GetPath().GetString() +
+                       " (" + formatBytes(rolledUp[leaves[i]].total()) + ")";
+        }
+        if (!largest.empty()) {
+            errors.push_back(largest);
+        }
+
+        std::string errorMsg = "Render memory estimate exceeded the configured budget:\n";
+        for (const auto& err : errors) {
+            errorMsg += "- " + err + "\n";
+        }
+        return {"Validate Render Memory", false, errorMsg};
+    }
+
+    std::string message = "Estimated render memory is " + formatBytes(totals.total()) + ": " +
+                          describeMemory(totals) + ".";
+    bool listedModels = false;
+    for (size_t i = 0; i < modelCount; ++i) {
+        if (hierarchy.modelParents[i] >= 0) {
+            continue;
+        }
+        pxr::TfToken kind;
+        pxr::UsdModelAPI(hierarchy.models[i]).GetKind(&kind);
+        message += std::string(listedModels ? "" : "\n") + "- Model " + hierarchy.models[i].GetPath().GetString() +
+                   " (" + kind.GetString() + "): " + formatBytes(rolledUp[i].total()) + "\n";
+        listedModels = true;
+    }
+
+    return {"Validate Render Memory", true, message};
+}
+
+/**
+ * @struct ValueRangeRule
+ * @brief Bounds that every component of an attribute's value must fall within.
+ */
+struct ValueRangeRule {
+    pxr::TfToken attribute;  // Attribute name, e.g. "primvars:displayColor"
+    pxr::TfType schema;      // Schema the prim must be, or unknown for any prim
+    double min;
+    double max;
+    bool minExclusive;       // True when the minimum itself is out of range
+};
+
+/**
+ * @brief Parses one bound of a range rule, accepting "inf" and "-inf".
+ * @return False unless the whole text is a number.
+ */
+bool parseRangeBound(const std::string& text, double& bound) {
+    char* end = nullptr;
+    bound = std::strtod(text.c_str(), &end);
+    return end != text.c_str() && *end == '\0' && !std::isnan(bound);
+}
+
+/**
+ * @brief Reads the value range rules checked by validateValueRanges() from a rules file.
+ *
+ * Each line holds five whitespace-separated columns: attribute, schema, min, max and exclusive.
+ * The schema is a TfType name such as UsdGeomPointInstancer, or "-" for any prim, and exclusive
+ * is "yes" when the minimum itself is out of range. Text after '#' is ignored. Adding a line is
+ * all it takes to check another attribute; data/value_range_rules.txt holds the shipped rules.
+ *
+ * @param path The rules file to read.
+ * @param rules Receives the rules in file order.
+ * @param error Receives the first problem found when loading fails.
+ * @return False if the file cannot be read or a line is malformed.
+ */
+bool loadValueRangeRules(const std::string& path, std::vector<ValueRangeRule>& rules, std::string& error) {
+    std::ifstream file(path);
+    if (!file) {
+        error = "Cannot read value range rules from " + path;
+        return false;
+    }
+
+    std::string line;
+    for (size_t lineNumber = 1; std::getline(file, line); ++lineNumber) {
+        std::istringstream columns(line.substr(0, line.find('#')));
+        std::string attribute, schema, min, max, exclusive, extra;
+        if (!(columns >> attribute)) {
+            continue;  // Blank or comment-only line
+        }
+
+        const std::string where = path + ":" + std::to_string(lineNumber) + ": ";
+        ValueRangeRule rule;
+        if (!(columns >> schema >> min >> max >> exclusive) || (columns >> extra)) {
+            error = where + "expected 'attribute schema min max exclusive'";
+            return false;
+        }
+        if (!parseRangeBound(min, rule.min) || !parseRangeBound(max, rule.max) || rule.min > rule.max) {
+            error = where + "invalid bounds '" + min + " " + max + "'";
+            return false;
+        }
+        if (exclusive != "yes" && exclusive != "no") {
+            error = where + "exclusive must be 'yes' or 'no', got '" + exclusive + "'";
+            return false;
+        }
+        if (schema != "-") {
+            rule.schema = pxr::TfType::FindByName(schema);
+            if (rule.schema.IsUnknown()) {
+                error = where + "unknown schema '" + schema + "'";
+                return false;
+            }
+        }
+        rule.attribute = pxr::TfToken(attribute);
+        rule.minExclusive = exclusive == "yes";
+        rules.push_back(rule);
+    }
+    return true;
+}
+
+/**
+ * @brief Formats the bounds of a range rule in interval notation, e.g. "(0, inf)".
+ */
+std::string describeRange(const ValueRangeRule& rule) {
+    std::ostringstream stream;
+    stream << (rule.minExclusive ? "(" : "[") << rule.min << ", " << rule.max
+           << (std::isinf(rule.max) ? ")" : "]");
+    return stream.str();
+}
+
+/**
+ * @brief Scans a value held as Element or VtArray<Element> against a range rule.
+ *
+ * Element is viewed as N consecutive Scalar components and scanned with a vectorizable kernel.
+ *
+ * @param count Receives the number of elements scanned.
+ * @param outside Receives the number of elements with a component out of range.
+ * @return False if the value holds neither Element nor VtArray<Element>.
+ */
+template <typename Element, size_t N, typename Scalar>
+bool scanValueRange(const pxr::VtValue& value, const ValueRangeRule& rule, size_t& count, size_t& outside) {
+    const Element* data = nullptr;
+    if (value.IsHolding<pxr::VtArray<Element>>()) {
+        const auto& array = value.UncheckedGet<pxr::VtArray<Element>>();
+        data = array.cdata();
+        count = array.size();
+    } else if (value.IsHolding<Element>()) {
+        data = &value.UncheckedGet<Element>();
+        count = 1;
+    } else {
+        return false;
+    }
+
+    const Scalar* scalars = reinterpret_cast<const Scalar*>(data);
+    const Scalar high = static_cast<Scalar>(rule.max);
+    const Scalar low = rule.minExclusive ? std::nextafter(static_cast<Scalar>(rule.min), high)
+                                         : static_cast<Scalar>(rule.min);
+    outside = arrayKernels::parallelCount(count, [=](size_t begin, size_t end) {
+        return arrayKernels::countOutsideRange<N>(scalars, begin, end, low, high);
+    });
+    return true;
+}
+
+/**
+ * @brief Validates authored attribute values against the value range rules file.
+ *
+ * Each rule read by loadValueRangeRules() from TestConfig::rangeRulesPath names an attribute,
+ * optionally restricted to prims of a schema type, and the interval its components must fall
+ * within. A rules file that cannot be read fails the test. Float and double scalars, vectors and
+ * arrays of them are supported; other value types are skipped. Every authored time sample is
+ * checked, so a value that leaves its range partway through an animation is reported with the
+ * first time it does; attributes without samples are checked at their default value.
+ *
+ * Prims are validated in parallel and each array is scanned in parallel chunks with a
+ * branch-free kernel, so large arrays are checked at close to memory bandwidth.
+ *
+ * @param stage The USD stage to validate.
+ * @param config The configuration naming the rules file.
+ * @return TestResult Containing:
+ *         - Test name ("Validate Value Ranges").
+ *         - Success/failure status.
+ *         - Detailed validation results or errors.
+ */
+TestResult validateValueRanges(const pxr::UsdStageRefPtr& stage, const TestConfig& config) {
+    if (!stage) {
+        return {"Validate Value Ranges", false, "Invalid stage reference."};
+    }
+
+    std::vector<ValueRangeRule> rules;
+    std::string rulesError;
+    if (!loadValueRangeRules(config.rangeRulesPath, rules, rulesError)) {
+        return {"Validate Value Ranges", false, rulesError + "."};
+    }
+
+    std::vector<pxr::UsdPrim> prims;
+    for (auto prim : stage->Traverse()) {
+        prims.push_back(prim);
+    }
+
+    std::vector<std::vector<std::string>> primErrors(prims.size());
+    std::vector<size_t> primChecked(prims.size(), 0);
+
+    // Counts the components of a value, and those outside a rule's range, for the supported types
+    auto scanValue = [](const pxr::VtValue& value, const ValueRangeRule& rule, size_t& count, size_t& outside) {
+        return scanValueRange<float, 1, float>(value, rule, count, outside) ||
+               scanValueRange<double, 1, double>(value, rule, count, outside) ||
+               scanValueRange<pxr::GfVec2f, 2, float>(value, rule, count, outside) ||
+               scanValueRange<pxr::GfVec3f, 3, float>(value, rule, count, outside) ||
+               scanValueRange<pxr::GfVec4f, 4, float>(value, rule, count, outside) ||
+               scanValueRange<pxr::GfVec3d, 3, double>(value, rule, count, outside);
+    };
+
+    pxr::WorkParallelForN(prims.size(), [&](size_t first, size_t last) {
+        std::vector<double> times;
+        for (size_t p = first; p < last; ++p) {
+            const pxr::UsdPrim& prim = prims[p];
+            for (const ValueRangeRule& rule : rules) {
+                if (!rule.schema.IsUnknown() && !prim.IsA(rule.schema)) {
+                    continue;
+                }
+                pxr::UsdAttribute attr = prim.GetAttribute(rule.attribute);
+                if (!attr || !attr.HasAuthoredValue() || !attr.GetTimeSamples(&times)) {
+                    continue;
+                }
+
+                size_t count = 0;
+                size_t outside = 0;
+                size_t samplesOutside = 0;
+                double firstOutside = 0.0;
+                bool scanned = false;
+                pxr::VtValue value;
+                if (times.empty()) {
+                    scanned = attr.Get(&value) && scanValue(value, rule, count, outside);
+                }
+                for (double time : times) {
+                    size_t sampleCount = 0;
+                    size_t sampleOutside = 0;
+                    if (!attr.Get(&value, time) || !scanValue(value, rule, sampleCount, sampleOutside)) {
+                        continue;
+                    }
+                    scanned = true;
+                    count += sampleCount;
+                    outside += sampleOutside;
+                    if (sampleOutside > 0 && samplesOutside++ == 0) {
+                        firstOutside = time;
+                    }
+                }
+                if (!scanned) {
+                    continue;
+                }
+
+                ++primChecked[p];
+                if (outside > 0) {
+                    std::string error = "Out of range " + rule.attribute.GetString() + " at " +
+                                        prim.GetPath().GetString() + ": " + std::to_string(outside) +
+                                        " of " + std::to_string(count) + " values outside " + describeRange(rule);
+                    if (!times.empty()) {
+                        std::ostringstream time;
+                        time << firstOutside;
+                        error += " in " + std::to_string(samplesOutside) + " of " + std::to_string(times.size()) +
+                                 " time samples, first at time " + time.str();
+                    }
+                    primErrors[p].push_back(error);
+                }
+            }
+        }
+    });
+
+    size_t checkedAttributes = 0;
+    std::vector<std::string> errors;
+    for (size_t p = 0; p < prims.size(); ++p) {
+        checkedAttributes += primChecked[p];
+        errors.insert(errors.end(), primErrors[p].begin(), primErrors[p].end());
+    }
+
+    if (checkedAttributes == 0) {
+        return {
+            "Validate Value Ranges",
+            true,
+            "No range-checked attributes found in the scene, which is acceptable."
+        };
+    }
+
+    if (!errors.empty()) {
+        std::string errorMsg = "Value range validation failed with the following issues:\n";
+        for (const auto& err : errors) {
+            errorMsg += "- " + err + "\n";
+        }
+        return {"Validate Value Ranges", false, errorMsg};
+    }
+
+    return {"Validate Value Ranges", true, "All " + std::to_string(checkedAttributes) +
+                                           " range-checked attributes are within their bounds."};
+}
+
+/**
+ * @brief Validates namespace hierarchy depth and fan-out in a USD file.
+ *
+ * Reports the maximum and percentile prim depths, the deepest prim paths and the prims with
+ * the most direct children, counting root prims as children of the pseudo-root "/". Fails when
+ * any prim is deeper than TestConfig::maxDepth or has more than TestConfig::maxChildren direct
+ * children (0 means unlimited).
+ *
+ * Depths and child counts come from the parent links of the run's shared ModelHierarchyCache,
+ * so no per-prim child queries are made and the stage is not traversed again when the census,
+ * the memory estimates or the hierarchy checks have already collected it.
+ *
+ * @param stage The USD stage to validate.
+ * @param config The configuration holding the depth and fan-out limits.
+ * @param hierarchies The run's model hierarchy cache, so the stage is traversed once per run.
+ * @return TestResult Containing:
+ *         - Test name ("Validate Hierarchy").
+ *         - Success/failure status.
+ *         - Hierarchy shape or the prims exceeding the limits.
+ */
+TestResult validateHierarchy(const pxr::UsdStageRefPtr& stage, const TestConfig& config,
+                             ModelHierarchyCache& hierarchies) {
+    if (!stage) {
+        return {"Validate Hierarchy", false, "Invalid stage reference."};
+    }
+
+    // Number of deepest and widest prims named in the report
+    static constexpr size_t kMaxListed = 3;
+
+    const ModelHierarchy& hierarchy = hierarchies.get(stage);
+    const size_t primCount = hierarchy.prims.size();
+    if (primCount == 0) {
+        return {
+            "Validate Hierarchy",
+            true,
+            "No prims found in the scene, which is acceptable."
+        };
+    }
+
+    // Parents precede their children, so one forward sweep settles every depth
+    std::vector<size_t> depths(primCount, 1);
+    std::vector<size_t> childCounts(primCount, 0);
+    size_t rootCount = 0;
+    size_t maxDepth = 0;
+    for (size_t i = 0; i < primCount; ++i) {
+        const int parent = hierarchy.primParents[i];
+        if (parent >= 0) {
+            depths[i] = depths[parent] + 1;
+            ++childCounts[parent];
+        } else {
+            ++rootCount;
+        }
+        maxDepth = std::max(maxDepth, depths[i]);
+    }
+
+    // Nearest-rank percentiles from a depth histogram
+    std::vector<size_t> depthHistogram(maxDepth + 1, 0);
+    for (size_t depth : depths) {
+        ++depthHistogram[depth];
+    }
+    auto depthPercentile = [&](size_t percent) {
+        const size_t rank = std::max<size_t>(1, (percent * primCount + 99) / 100);
+        size_t seen = 0;
+        for (size_t depth = 1; depth <= maxDepth; ++depth) {
+            seen += depthHistogram[depth];
+            if (seen >= rank) {
+                return depth;
+            }
+        }
+        return maxDepth;
+    };
+
+    // The pseudo-root is listed alongside the traversed prims as "/"
+    std::vector<std::pair<size_t, std::string>> fanOuts;
+    fanOuts.emplace_back(rootCount, "/");
+    for (size_t i = 0; i < primCount; ++i) {
+        if (childCounts[i] > 0) {
+            fanOuts.emplace_back(childCounts[i], hierarchy.prims[i].GetPath().GetString());
+        }
+    }
+    std::stable_sort(fanOuts.begin(), fanOuts.end(), [](const auto& a, const auto& b) {
+        return a.first > b.first;
+    });
+
+    std::vector<size_t> deepest(primCount);
+    for (size_t i = 0; i < primCount; ++i) {
+        deepest[i] = i;
+    }
+    std::stable_sort(deepest.begin(), deepest.end(), [&depths](size_t a, size_t b) {
+        return depths[a] > depths[b];
+    });
+    deepest.resize(std::min(kMaxListed, primCount));
+
+    std::vector<std::string> errors;
+    if (config.maxDepth > 0 && maxDepth > config.maxDepth) {
+        size_t tooDeep = 0;
+        for (size_t depth = config.maxDepth + 1; depth <= maxDepth; ++depth) {
+            tooDeep += depthHistogram[depth];
+        }
+        errors.push_back(std::to_string(tooDeep) + " prims are deeper than the limit of " +
+                         std::to_string(config.maxDepth) + "; deepest is " +
+                         hierarchy.prims[deepest.front()].GetPath().GetString() + " at depth " +
+                         std::to_string(maxDepth));
+    }
+    if (config.maxChildren > 0) {
+        for (const auto& [count, path] : fanOuts) {
+            if (count <= config.maxChildren) {
+                break;
+            }
+            errors.push_back("Extreme fan-out at " + path + ": " + std::to_string(count) +
+                             " children exceed the limit of " + std::to_string(config.maxChildren));
+        }
+    }
+
+    if (!errors.empty()) {
+        std::string errorMsg = "Hierarchy validation failed with the following issues:\n";
+        for (const auto& err : errors) {
+            errorMsg += "- " + err + "\n";
+        }
+        return {"Validate Hierarchy", false, errorMsg};
+    }
+
+    std::string message = std::to_string(primCount) + " prims have a maximum depth of " + std::to_string(maxDepth) +
+                          " (median " + std::to_string(depthPercentile(50)) + ", 90th percentile " +
+                          std::to_string(depthPercentile(90)) + ", 99th percentile " +
+                          std::to_string(depthPercentile(99)) + ") and a maximum fan-out of " +
+                          std::to_string(fanOuts.front().first) + ".\n";
+    for (size_t i : deepest) {
+        message += "- Deepest: " + hierarchy.prims[i].GetPath().GetString() + " (depth " +
+                   std::to_string(depths[i]) + ")\n";
+    }
+    for (size_t i = 0; i < fanOuts.size() && i < kMaxListed; ++i) {
+        const size_t count = fanOuts[i].first;
+        message += "- Widest: " + fanOuts[i].second + " (" + std::to_string(count) +
+                   (count == 1 ? " child)\n" : " children)\n");
+    }
+
+    return {"Validate Hierarchy", true, message};
+}
+
+/**
+ * @brief Validates the face GeomSubset families of every mesh in a USD file.
+ *
+ * For each family of face subsets on a mesh, checks that:
+ * - Subset indices fall within the mesh's face count.
+ * - No face is assigned more than once when the family type is partition or nonOverlapping.
+ * - Every face is assigned when the family type is partition.
+ *
+ * Each family is accumulated into a bitset with one bit per face. Overlaps are the in-range
+ * indices that did not add a new bit, and coverage is the bitset's population count, so a
+ * family is checked in time linear in its indices plus one word per 64 faces. Meshes are
+ * validated in parallel.
+ *
+ * @param stage The USD stage to validate.
+ * @return TestResult Containing:
+ *         - Test name ("Validate Geom Subsets").
+ *         - Success/failure status.
+ *         - Detailed validation results or errors.
+ */
+TestResult validateGeomSubsets(const pxr::UsdStageRefPtr& stage) {
+    if (!stage) {
+        return {"Validate Geom Subsets", false, "Invalid stage reference."};
+    }
+
+    std::vector<pxr::UsdPrim> meshes;
+    for (auto prim : stage->Traverse()) {
+        if (prim.IsA<pxr::UsdGeomMesh>()) {
+            meshes.push_back(prim);
+        }
+    }
+
+    std::vector<std::vector<std::string>> meshErrors(meshes.size());
+    std::vector<size_t> meshFamilies(meshes.size(), 0);
+
+    pxr::WorkParallelForN(meshes.size(), [&](size_t first, size_t last) {
+        for (size_t m = first; m < last; ++m) {
+            const pxr::UsdGeomImageable geom(meshes[m]);
+            std::vector<std::string>& errors = meshErrors[m];
+            const std::string path = meshes[m].GetPath().GetString();
+
+            pxr::VtIntArray faceVertexCounts;
+            pxr::UsdGeomMesh(meshes[m]).GetFaceVertexCountsAttr().Get(&faceVertexCounts);
+            const size_t faceCount = faceVertexCounts.size();
+
+            for (const auto& family : pxr::UsdGeomSubset::GetAllGeomSubsetFamilyNames(geom)) {
+                const std::vector<pxr::UsdGeomSubset> subsets =
+                    pxr::UsdGeomSubset::GetGeomSubsets(geom, pxr::UsdGeomTokens->face, family);
+                if (subsets.empty()) {
+                    continue;
+                }
+                ++meshFamilies[m];
+
+                const pxr::TfToken familyType = pxr::UsdGeomSubset::GetFamilyType(geom, family);
+                std::vector<uint64_t> assigned((faceCount + 63) / 64, 0);
+                size_t inRangeIndices = 0;
+
+                for (const auto& subset : subsets) {
+                    pxr::VtIntArray indices;
+                    subset.GetIndicesAttr().Get(&indices);
+                    const int* indexData = indices.cdata();
+
+                    size_t badIndices = arrayKernels::parallelCount(indices.size(), [=](size_t begin, size_t end) {
+                        return arrayKernels::countOutOfRange(indexData, begin, end, faceCount);
+                    });
+                    if (badIndices > 0) {
+                        errors.push_back("Out of range indices in subset " + subset.GetPath().GetString() + ": " +
+                                         std::to_string(badIndices) + " of " + std::to_string(indices.size()) +
+                                         " outside [0, " + std::to_string(faceCount) + ")");
+                    }
+
+                    inRangeIndices += indices.size() - badIndices;
+                    arrayKernels::setIndexBits(assigned, indexData, indices.size(), faceCount);
+                }
+
+                const size_t assignedFaces = arrayKernels::countSetBits(assigned);
+                const std::string familyDesc = "family '" + family.GetString() + "' (" + familyType.GetString() +
+                                               ") at " + path;
+                if (familyType != pxr::UsdGeomTokens->unrestricted && inRangeIndices > assignedFaces) {
+                    errors.push_back("Overlapping subsets in " + familyDesc + ": " +
+                                     std::to_string(inRangeIndices - assignedFaces) + " repeated face assignments");
+                }
+                if (familyType == pxr::UsdGeomTokens->partition && assignedFaces < faceCount) {
+                    errors.push_back("Incomplete partition in " + familyDesc + ": " +
+                                     std::to_string(faceCount - assignedFaces) + " of " +
+                                     std::to_string(faceCount) + " faces are not in any subset");
+                }
+            }
+        }
+    });
+
+    size_t familyCount = 0;
+    std::vector<std::string> errors;
+    for (size_t m = 0; m < meshes.size(); ++m) {
+        familyCount += meshFamilies[m];
+        errors.insert(errors.end(), meshErrors[m].begin(), meshErrors[m].end());
+    }
+
+    if (familyCount == 0) {
+        return {
+            "Validate Geom Subsets",
+            true,
+            "No face subsets found in the scene, which is acceptable."
+        };
+    }
+
+    if (!errors.empty()) {
+        std::string errorMsg = "Geom subset validation failed with the following issues:\n";
+        for (const auto& err : errors) {
+            errorMsg += "- " + err + "\n";
+        }
+        return {"Validate Geom Subsets", false, errorMsg};
+    }
+
+    return {"Validate Geom Subsets", true, "All " + std::to_string(familyCount) +
+                                           " face subset families are in range and honor their family type."};
+}
+
+/**
+ * @brief Flags points that lie within a tolerance of a lower-numbered point.
+ *
+ * Points are bucketed into a spatial hash grid with cells as wide as the tolerance, so any
+ * coincident pair falls in the same or an adjacent cell. Hashing and the neighbor queries both
+ * run in parallel, and each query only compares against points in the 27 surrounding cells.
+ *
+ * @param points The points to search.
+ * @param tolerance The maximum distance at which two points are considered coincident.
+ * @param redundant Receives 1 for every point that duplicates an earlier point, else 0.
+ * @return The number of redundant points.
+ */
+size_t findCoincidentPoints(const pxr::VtVec3fArray& points, float tolerance, std::vector<uint8_t>& redundant) {
+    const size_t count = points.size();
+    const pxr::GfVec3f* data = points.cdata();
+    const double cellsPerUnit = 1.0 / tolerance;
+    const float toleranceSq = tolerance * tolerance;
+    redundant.assign(count, 0);
+
+    // Non-finite or out of range coordinates share cell 0; the distance test still rejects them
+    auto cellOf = [cellsPerUnit](float value) {
+        const double cell = std::floor(static_cast<double>(value) * cellsPerUnit);
+        return std::fabs(cell) < 4.0e18 ? static_cast<int64_t>(cell) : int64_t(0);
+    };
+    auto hashCell = [](int64_t x, int64_t y, int64_t z) {
+        return (static_cast<uint64_t>(x) * 73856093u) ^ (static_cast<uint64_t>(y) * 19349663u) ^
+               (static_cast<uint64_t>(z) * 83492791u);
+    };
+
+    // Sorting by (cell hash, point index) groups each cell's points in index order
+    std::vector<std::pair<uint64_t, size_t>> grid(count);
+    pxr::WorkParallelForN(count, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            grid[i] = {hashCell(cellOf(data[i][0]), cellOf(data[i][1]), cellOf(data[i][2])), i};
+        }
+    });
+    std::sort(grid.begin(), grid.end());
+
+    return arrayKernels::parallelCount(count, [&](size_t begin, size_t end) {
+        size_t found = 0;
+        for (size_t i = begin; i < end; ++i) {
+            const int64_t x = cellOf(data[i][0]);
+            const int64_t y = cellOf(data[i][1]);
+            const int64_t z = cellOf(data[i][2]);
+            bool duplicate = false;
+            for (int64_t dx = -1; dx <= 1 && !duplicate; ++dx) {
+                for (int64_t dy = -1; dy <= 1 && !duplicate; ++dy) {
+                    for (int64_t dz = -1; dz <= 1 && !duplicate; ++dz) {
+                        const uint64_t key = hashCell(x + dx, y + dy, z + dz);
+                        for (auto it = std::lower_bound(grid.begin(), grid.end(), std::make_pair(key, size_t(0)));
+                             it != grid.end() && it->first == key && it->second < i; ++it) {
+                            if ((data[it->second] - data[i]).GetLengthSq() <= toleranceSq) {
+                                duplicate = true;
+                                break;
+                            }
+                        }
+                    }
+                }
+            }
+            redundant[i] = duplicate;
+            found += duplicate;
+        }
+        return found;
+    });
+}
+
+/**
+ * @brief Returns the bytes a mesh stores per point: the point itself plus vertex-rate primvars.
+ */
+size_t bytesPerMeshPoint(const pxr::UsdGeomMesh& mesh, size_t pointCount) {
+    size_t bytes = sizeof(pxr::GfVec3f);
+    if (pointCount == 0) {
+        return bytes;
+    }
+
+    const pxr::TfToken normalsInterpolation = mesh.GetNormalsInterpolation();
+    if (mesh.GetNormalsAttr().HasAuthoredValue() && (normalsInterpolation == pxr::UsdGeomTokens->vertex ||
+                                                     normalsInterpolation == pxr::UsdGeomTokens->varying)) {
+        bytes += sizeof(pxr::GfVec3f);
+    }
+
+    for (const auto& primvar : pxr::UsdGeomPrimvarsAPI(mesh.GetPrim()).GetAuthoredPrimvars()) {
+        const pxr::TfToken interpolation = primvar.GetInterpolation();
+        if (interpolation != pxr::UsdGeomTokens->vertex && interpolation != pxr::UsdGeomTokens->varying) {
+            continue;
+        }
+        // Indexed primvars store one index per point and share their values
+        bytes += primvar.IsIndexed() ? sizeof(int) : attributeValueBytes(primvar.GetAttr()) / pointCount;
+    }
+    return bytes;
+}
+
+/**
+ * @brief Finds wasted mesh points: points no face references and coincident duplicates.
+ *
+ * For each mesh:
+ * - Referenced points are marked in a bitset over faceVertexIndices, and the unmarked points
+ *   are reported as unreferenced.
+ * - Points within a small tolerance of an earlier point are found with findCoincidentPoints().
+ *
+ * The wasted bytes per mesh count each wasted point once, at the size of the point plus its
+ * vertex and varying primvars. Meshes are validated in parallel.
+ *
+ * @param stage The USD stage to validate.
+ * @return TestResult Containing:
+ *         - Test name ("Validate Mesh Points").
+ *         - Success/failure status.
+ *         - Detailed validation results or errors.
+ */
+TestResult validateMeshPoints(const pxr::UsdStageRefPtr& stage) {
+    if (!stage) {
+        return {"Validate Mesh Points", false, "Invalid stage reference."};
+    }
+
+    // Points closer than this, in scene units, are treated as coincident
+    static constexpr float kCoincidentTolerance = 1e-5f;
+
+    std::vector<pxr::UsdPrim> meshes;
+    for (auto prim : stage->Traverse()) {
+        if (prim.IsA<pxr::UsdGeomMesh>()) {
+            meshes.push_back(prim);
+        }
+    }
+
+    if (meshes.empty()) {
+        return {
+            "Validate Mesh Points",
+            true,
+            "No meshes found in the scene, which is acceptable."
+        };
+    }
+
+    std::vector<std::string> meshErrors(meshes.size());
+
+    pxr::WorkParallelForN(meshes.size(), [&](size_t first, size_t last) {
+        for (size_t m = first; m < last; ++m) {
+            pxr::UsdGeomMesh mesh(meshes[m]);
+            pxr::VtVec3fArray points;
+            pxr::VtIntArray faceVertexIndices;
+            mesh.GetPointsAttr().Get(&points);
+            mesh.GetFaceVertexIndicesAttr().Get(&faceVertexIndices);
+            const size_t pointCount = points.size();
+
+            std::vector<uint64_t> referenced((pointCount + 63) / 64, 0);
+            arrayKernels::setIndexBits(referenced, faceVertexIndices.cdata(), faceVertexIndices.size(), pointCount);
+            const size_t unreferenced = pointCount - arrayKernels::countSetBits(referenced);
+
+            std::vector<uint8_t> redundant;
+            const size_t coincident = findCoincidentPoints(points, kCoincidentTolerance, redundant);
+            if (unreferenced == 0 && coincident == 0) {
+                continue;
+            }
+
+            // A point that is both unreferenced and coincident is only wasted once
+            size_t wasted = 0;
+            for (size_t i = 0; i < pointCount; ++i) {
+                wasted += redundant[i] | !((referenced[i >> 6] >> (i & 63)) & 1);
+            }
+
+            std::ostringstream tolerance;
+            tolerance << kCoincidentTolerance;
+            meshErrors[m] = "Wasted points at " + meshes[m].GetPath().GetString() + ": " +
+                            std::to_string(unreferenced) + " unreferenced and " + std::to_string(coincident) +
+                            " coincident within " + tolerance.str() + " of another point (" +
+                            std::to_string(wasted) + " of " + std::to_string(pointCount) + ", " +
+                            formatPercent(wasted, pointCount) + ", " +
+                            formatBytes(wasted * bytesPerMeshPoint(mesh, pointCount)) + ")";
+        }
+    });
+
+    std::vector<std::string> errors;
+    for (const auto& message : meshErrors) {
+        if (!message.empty()) {
+            errors.push_back(message);
+        }
+    }
+
+    if (!errors.empty()) {
+        std::string errorMsg = "Mesh point validation failed with the following issues:\n";
+        for (const auto& err : errors) {
+            errorMsg += "- " + err + "\n";
+        }
+        return {"Validate Mesh Points", false, errorMsg};
+    }
+
+    return {"Validate Mesh Points", true, "All " + std::to_string(meshes.size()) +
+                                          " meshes reference every point and have no coincident points."};
+}
+
+/**
+ * @struct NetworkConnection
+ * @brief One authored connection inside a material network.
+ */
+struct NetworkConnection {
+    int node;                     // Index of the node owning the connected attribute, or -1 for the material
+    pxr::UsdAttribute attribute;  // The connected input or output
+    pxr::SdfPath source;          // The attribute it reads from
+    int sourceNode;               // Index of the source's node, or -1 if it is outside the network
+};
+
+/**
+ * @struct MaterialNetwork
+ * @brief A material's shaders and node graphs as a compact adjacency graph.
+ *
+ * Edges point upstream, from the node reading a value to the node producing it.
+ */
+struct MaterialNetwork {
+    pxr::UsdPrim material;
+    std::vector<pxr::UsdPrim> nodes;               // In namespace order
+    std::vector<std::vector<int>> upstream;        // Source nodes of each node's connections
+    std::vector<NetworkConnection> connections;    // In node order, material outputs first
+};
+
+/**
+ * @brief Builds the network of a material by reading each connection exactly once.
+ *
+ * Shaders and node graphs below the material become nodes; nested materials are left to be
+ * built as networks of their own.
+ */
+MaterialNetwork buildMaterialNetwork(const pxr::UsdPrim& material) {
+    MaterialNetwork network;
+    network.material = material;
+
+    std::unordered_map<pxr::SdfPath, int, pxr::SdfPath::Hash> nodeIndices;
+    pxr::UsdPrimRange range(material);
+    for (auto it = range.begin(); it != range.end(); ++it) {
+        if (*it == material) {
+            continue;
+        }
+        if (it->IsA<pxr::UsdShadeMaterial>()) {
+            it.PruneChildren();
+            continue;
+        }
+        if (it->IsA<pxr::UsdShadeShader>() || it->IsA<pxr::UsdShadeNodeGraph>()) {
+            nodeIndices[it->GetPath()] = static_cast<int>(network.nodes.size());
+            network.nodes.push_back(*it);
+        }
+    }
+    network.upstream.resize(network.nodes.size());
+
+    auto addConnections = [&](int node, const pxr::UsdAttribute& attribute) {
+        pxr::SdfPathVector sources;
+        attribute.GetConnections(&sources);
+        for (const auto& source : sources) {
+            auto found = nodeIndices.find(source.GetPrimPath());
+            const int sourceNode = found != nodeIndices.end() ? found->second : -1;
+            network.connections.push_back({node, attribute, source, sourceNode});
+            // Reading a node graph's interface input from inside it does not depend on the node graph's outputs
+            const bool interfaceRead = node >= 0 && sourceNode >= 0 &&
+                                       network.nodes[node].GetPath().HasPrefix(source.GetPrimPath()) &&
+                                       source.GetNameToken().GetString().compare(0, 7, "inputs:") == 0;
+            if (node >= 0 && sourceNode >= 0 && !interfaceRead) {
+                network.upstream[node].push_back(sourceNode);
+            }
+        }
+    };
+
+    for (const auto& output : pxr::UsdShadeMaterial(material).GetOutputs()) {
+        addConnections(-1, output.GetAttr());
+    }
+    for (size_t i = 0; i < network.nodes.size(); ++i) {
+        pxr::UsdShadeConnectableAPI connectable(network.nodes[i]);
+        for (const auto& input : connectable.GetInputs()) {
+            addConnections(static_cast<int>(i), input.GetAttr());
+        }
+        for (const auto& output : connectable.GetOutputs()) {
+            addConnections(static_cast<int>(i), output.GetAttr());
+        }
+    }
+
+    return network;
+}
+
+/**
+ * @brief Returns the terminal name of a material output, e.g. "surface" for "outputs:ri:surface".
+ */
+std::string materialOutputTerminal(const pxr::UsdAttribute& output) {
+    const std::string& name = output.GetName().GetString();
+    return name.substr(name.rfind(':') + 1);
+}
+
+/**
+ * @brief Flags the nodes of a network reachable upstream from its connected material outputs.
+ */
+std::vector<bool> reachableNodes(const MaterialNetwork& network) {
+    // Connected material outputs are the roots of the upstream walk
+    std::vector<int> pending;
+    for (const auto& connection : network.connections) {
+        if (connection.node < 0 && connection.sourceNode >= 0) {
+            pending.push_back(connection.sourceNode);
+        }
+    }
+
+    std::vector<bool> reached(network.nodes.size(), false);
+    while (!pending.empty()) {
+        const int node = pending.back();
+        pending.pop_back();
+        if (reached[node]) {
+            continue;
+        }
+        reached[node] = true;
+        pending.insert(pending.end(), network.upstream[node].begin(), network.upstream[node].end());
+    }
+    return reached;
+}
+
+/**
+ * @struct MaterialNetworkCache
+ * @brief The network of every material on a stage, built on first use and shared by every test of a run.
+ *
+ * The network, duplicate, orphan and connection type checks all read the same graphs, so the
+ * runner owns one cache and each material is visited once however many of them are enabled.
+ * The networks are rebuilt if a different stage is passed in.
+ */
+struct MaterialNetworkCache {
+    pxr::UsdStageRefPtr stage;              // Stage the networks were built from
+    std::vector<MaterialNetwork> networks;  // In traversal order of their materials
+
+    // Returns the material networks of a stage, building them in parallel on first use
+    const std::vector<MaterialNetwork>& get(const pxr::UsdStageRefPtr& usdStage) {
+        if (stage != usdStage) {
+            std::vector<pxr::UsdPrim> materials;
+            for (auto prim : usdStage->Traverse()) {
+                if (prim.IsA<pxr::UsdShadeMaterial>()) {
+                    materials.push_back(prim);
+                }
+            }
+            networks.assign(materials.size(), MaterialNetwork());
+            pxr::WorkParallelForN(materials.size(), [&](size_t first, size_t last) {
+                for (size_t m = first; m < last; ++m) {
+                    networks[m] = buildMaterialNetwork(materials[m]);
+                }
+            });
+            stage = usdStage;
+        }
+        return networks;
+    }
+};
+
+/**
+ * @brief Validates the shading network of every material in a USD file.
+ *
+ * Each material's network comes from the run's shared MaterialNetworkCache, and all checks run
+ * on that graph:
+ * - Every connection resolves to an existing prim, and stays inside the material unless it
+ *   reads one of the material's own interface inputs.
+ * - At least one surface, displacement or volume output is connected into the network.
+ * - The network has no cycles.
+ *
+ * Nodes that no material output reaches are left to validateOrphanedShading(), which reports
+ * them with the bytes they hold. Materials are validated in parallel.
+ *
+ * @param stage The USD stage to validate.
+ * @param networks The run's material network cache, so each material is visited once per run.
+ * @return TestResult Containing:
+ *         - Test name ("Validate Material Networks").
+ *         - Success/failure status.
+ *         - Detailed validation results or errors.
+ */
+TestResult validateMaterialNetworks(const pxr::UsdStageRefPtr& stage, MaterialNetworkCache& networks) {
+    if (!stage) {
+        return {"Validate Material Networks", false, "Invalid stage reference."};
+    }
+
+    const std::vector<MaterialNetwork>& materialNetworks = networks.get(stage);
+    if (materialNetworks.empty()) {
+        return {
+            "Validate Material Networks",
+            true,
+            "No materials found in the scene, which is acceptable."
+        };
+    }
+
+    std::vector<std::vector<std::string>> materialErrors(materialNetworks.size());
+
+    pxr::WorkParallelForN(materialNetworks.size(), [&](size_t first, size_t last) {
+        for (size_t m = first; m < last; ++m) {
+            const MaterialNetwork& network = materialNetworks[m];
+            std::vector<std::string>& errors = materialErrors[m];
+            const std::string path = network.material.GetPath().GetString();
+            const size_t nodeCount = network.nodes.size();
+
+            bool hasTerminal = false;
+            for (const auto& connection : network.connections) {
+                const std::string owner = connection.attribute.GetPath().GetString();
+                if (!stage->GetPrimAtPath(connection.source.GetPrimPath())) {
+                    errors.push_back("Connection from " + owner + " to missing prim: " + connection.source.GetString());
+                    continue;
+                }
+                if (connection.sourceNode < 0 && connection.source.GetPrimPath() != network.material.GetPath()) {
+                    errors.push_back("Connection from " + owner + " leaves material " + path + ": " +
+                                     connection.source.GetString());
+                    continue;
+                }
+                if (connection.node < 0 && connection.sourceNode >= 0) {
+                    const std::string terminal = materialOutputTerminal(connection.attribute);
+                    hasTerminal |= terminal == "surface" || terminal == "displacement" || terminal == "volume";
+                }
+            }
+            if (!hasTerminal) {
+                errors.push_back("Material has no connected surface, displacement or volume output: " + path);
+            }
+
+            // Iterative depth-first search; a grey node met again closes a cycle
+            enum : uint8_t { kWhite, kGrey, kBlack };
+            std::vector<uint8_t> color(nodeCount, kWhite);
+            std::vector<int> parent(nodeCount, -1);
+            for (size_t start = 0; start < nodeCount; ++start) {
+                if (color[start] != kWhite) {
+                    continue;
+                }
+                std::vector<std::pair<int, size_t>> stack = {{static_cast<int>(start), 0}};
+                color[start] = kGrey;
+                while (!stack.empty()) {
+                    auto& [node, next] = stack.back();
+                    if (next == network.upstream[node].size()) {
+                        color[node] = kBlack;
+                        stack.pop_back();
+                        continue;
+                    }
+                    const int source = network.upstream[node][next++];
+                    if (color[source] == kWhite) {
+                        color[source] = kGrey;
+                        parent[source] = node;
+                        stack.push_back({source, 0});
+                    } else if (color[source] == kGrey) {
+                        std::string cycle = network.nodes[source].GetPath().GetString();
+                        for (int n = node; n != source && n >= 0; n = parent[n]) {
+                            cycle = network.nodes[n].GetPath().GetString() + " -> " + cycle;
+                        }
+                        errors.push_back("Cycle in material network: " + network.nodes[source].GetPath().GetString() +
+                                         " -> " + cycle);
+                    }
+                }
+            }
+        }
+    });
+
+    std::vector<std::string> errors;
+    for (const auto& messages : materialErrors) {
+        errors.insert(errors.end(), messages.begin(), messages.end());
+    }
+
+    if (!errors.empty()) {
+        std::string errorMsg = "Material network validation failed with the following issues:\n";
+        for (const auto& err : errors) {
+            errorMsg += "- " + err + "\n";
+        }
+        return {"Validate Material Networks", false, errorMsg};
+    }
+
+    return {"Validate Material Networks", true, "All " + std::to_string(materialNetworks.size()) +
+                                                " material networks are acyclic, self-contained and connected to a "
+                                                "surface, displacement or volume output."};
+}
+
+/**
+ * @struct CollectionMembershipCache
+ * @brief Collection membership queries, computed at most once per collection and shared between tests.
+ *
+ * The map type is the one UsdShadeMaterialBindingAPI uses for its own collection queries, so
+ * the cache can be handed directly to material binding resolution. It is safe to use from
+ * several threads at once; two threads racing on the same collection may both compute its
+ * query, but only the first one is kept.
+ */
+struct CollectionMembershipCache {
+    pxr::UsdShadeMaterialBindingAPI::CollectionQueryCache queries;  // Keyed by collection path
+
+    // Returns the membership query of a collection, computing it on first use
+    const pxr::UsdCollectionAPI::MembershipQuery& get(const pxr::UsdCollectionAPI& collection) {
+        const pxr::SdfPath path = collection.GetCollectionPath();
+        auto found = queries.find(path);
+        if (found == queries.end()) {
+            found = queries.emplace(path, std::make_unique<pxr::UsdCollectionAPI::MembershipQuery>(
+                                              collection.ComputeMembershipQuery())).first;
+        }
+        return *found->second;
+    }
+};
+
+/**
+ * @brief Validates material bindings and resolves the bound material of every gprim in a USD file.
+ *
+ * Checks that:
+ * - Every material binding relationship targets existing prims, and that the material target
+ *   of each direct or collection-based binding is a UsdShadeMaterial.
+ * - Every gprim resolves to a material, once the scene authors any bindings at all.
+ *
+ * Bound materials are resolved for all gprims in parallel, sharing one bindings cache so the
+ * bindings of common ancestors are read once, instead of walking the hierarchy separately for
+ * each prim. Collection-based bindings take their membership queries from the shared
+ * CollectionMembershipCache, so each collection is computed once across this test and
+ * validateCollections().
+ *
+ * @param stage The USD stage to validate.
+ * @param collections The collection membership queries shared between tests.
+ * @return TestResult Containing:
+ *         - Test name ("Validate Material Bindings").
+ *         - Success/failure status.
+ *         - Detailed validation results or errors.
+ */
+TestResult validateMaterialBindings(const pxr::UsdStageRefPtr& stage, CollectionMembershipCache& collections) {
+    if (!stage) {
+        return {"Validate Material Bindings", false, "Invalid stage reference."};
+    }
+
+    // Number of unbound gprims named in the report
+    static constexpr size_t kMaxListed = 5;
+
+    std::vector<pxr::UsdPrim> prims;
+    std::vector<pxr::UsdPrim> gprims;
+    for (auto prim : stage->Traverse()) {
+        prims.push_back(prim);
+        if (prim.IsA<pxr::UsdGeomGprim>()) {
+            gprims.push_back(prim);
+        }
+    }
+
+    std::vector<std::vector<std::string>> primErrors(prims.size());
+    std::vector<uint8_t> primHasBinding(prims.size(), 0);
+    const std::string kBindingPrefix = "material:binding";
+    const std::string kCollectionBindingPrefix = "material:binding:collection:";
+
+    pxr::WorkParallelForN(prims.size(), [&](size_t first, size_t last) {
+        for (size_t p = first; p < last; ++p) {
+            for (const auto& rel : prims[p].GetAuthoredRelationships()) {
+                const std::string& name = rel.GetName().GetString();
+                if (name.compare(0, kBindingPrefix.size(), kBindingPrefix) != 0) {
+                    continue;
+                }
+                primHasBinding[p] = 1;
+
+                pxr::SdfPathVector targets;
+                rel.GetTargets(&targets);
+                const bool isCollectionBinding =
+                    name.compare(0, kCollectionBindingPrefix.size(), kCollectionBindingPrefix) == 0;
+                for (const auto& target : targets) {
+                    pxr::UsdPrim targetPrim = stage->GetPrimAtPath(target.GetPrimPath());
+                    if (!targetPrim) {
+                        primErrors[p].push_back("Dangling material binding at " + rel.GetPath().GetString() + ": " +
+                                                target.GetString() + " does not exist");
+                    } else if (target.IsPrimPath() && !targetPrim.IsA<pxr::UsdShadeMaterial>()) {
+                        primErrors[p].push_back("Material binding at " + rel.GetPath().GetString() +
+                                                " targets a non-material prim: " + target.GetString());
+                    } else if (!target.IsPrimPath() && !isCollectionBinding) {
+                        primErrors[p].push_back("Material binding at " + rel.GetPath().GetString() +
+                                                " targets a property instead of a material: " + target.GetString());
+                    }
+                }
+            }
+        }
+    });
+
+    std::vector<std::string> errors;
+    bool foundAnyBinding = false;
+    for (size_t p = 0; p < prims.size(); ++p) {
+        foundAnyBinding |= primHasBinding[p] != 0;
+        errors.insert(errors.end(), primErrors[p].begin(), primErrors[p].end());
+    }
+
+    if (!foundAnyBinding) {
+        return {
+            "Validate Material Bindings",
+            true,
+            "No material bindings found in the scene, which is acceptable."
+        };
+    }
+
+    pxr::UsdShadeMaterialBindingAPI::BindingsCache bindingsCache;
+    std::vector<pxr::UsdShadeMaterial> boundMaterials(gprims.size());
+    pxr::WorkParallelForN(gprims.size(), [&](size_t first, size_t last) {
+        for (size_t i = first; i < last; ++i) {
+            boundMaterials[i] = pxr::UsdShadeMaterialBindingAPI(gprims[i]).ComputeBoundMaterial(
+                &bindingsCache, &collections.queries, pxr::UsdShadeTokens->allPurpose);
+        }
+    });
+
+    std::vector<std::string> unbound;
+    for (size_t i = 0; i < gprims.size(); ++i) {
+        if (!boundMaterials[i]) {
+            unbound.push_back(gprims[i].GetPath().GetString());
+        }
+    }
+    if (!unbound.empty()) {
+        std::string listed;
+        for (size_t i = 0; i < unbound.size() && i < kMaxListed; ++i) {
+            listed += (i == 0 ? "" : ", ") + unbound[i];
+        }
+        if (unbound.size() > kMaxListed) {
+            listed += " and " + std::to_string(unbound.size() - kMaxListed) + " more";
+        }
+        errors.push_back(std::to_string(unbound.size()) + " of " + std::to_string(gprims.size()) +
+                         " gprims resolve to no material: " + listed);
+    }
+
+    if (!errors.empty()) {
+        std::string errorMsg = "Material binding validation failed with the following issues:\n";
+        for (const auto& err : errors) {
+            errorMsg += "- " + err + "\n";
+        }
+        return {"Validate Material Bindings", false, errorMsg};
+    }
+
+    return {"Validate Material Bindings", true, "All " + std::to_string(gprims.size()) +
+                                                " gprims resolve to a material."};
+}
+
+/**
+ * @brief Validates every texture asset referenced by a shader input in a USD file.
+ *
+ * Collects all texture path shader inputs with collectShaderTextures(), which resolves them
+ * concurrently, then probes each unique resolved file once, in parallel, by reading only its
+ * image header. Reports:
+ * - Asset paths that do not resolve to a file.
+ * - Files whose header is unreadable or of an unrecognized format.
+ * - Files whose contents do not match the format implied by their extension.
+ *
+ * UDIM tile set paths (containing "<UDIM>") name several files and are not probed.
+ *
+ * @param stage The USD stage to validate.
+ * @return TestResult Containing:
+ *         - Test name ("Validate Textures").
+ *         - Success/failure status.
+ *         - Detailed validation results or errors.
+ */
+TestResult validateTextures(const pxr::UsdStageRefPtr& stage) {
+    if (!stage) {
+        return {"Validate Textures", false, "Invalid stage reference."};
+    }
+
+    std::vector<pxr::UsdPrim> shaders;
+    for (auto prim : stage->Traverse()) {
+        if (prim.IsA<pxr::UsdShadeShader>()) {
+            shaders.push_back(prim);
+        }
+    }
+
+    const std::vector<ShaderTextureUse> uses = collectShaderTextures(shaders);
+    if (uses.empty()) {
+        return {
+            "Validate Textures",
+            true,
+            "No texture assets found in the scene, which is acceptable."
+        };
+    }
+
+    std::vector<std::string> errors;
+    std::vector<size_t> firstUses;  // Index of the first use of each unique resolved file
+    std::unordered_set<std::string> seen;
+    for (size_t i = 0; i < uses.size(); ++i) {
+        const ShaderTextureUse& use = uses[i];
+        const std::string input = use.shader.GetPath().GetString() + ".inputs:" + use.inputName.GetString();
+        if (use.assetPath.find("<UDIM>") != std::string::npos) {
+            continue;
+        }
+        if (use.resolvedPath.empty()) {
+            errors.push_back("Unresolved texture " + use.assetPath + " at " + input);
+        } else if (seen.insert(use.resolvedPath).second) {
+            firstUses.push_back(i);
+        }
+    }
+
+    std::vector<ImageHeader> headers(firstUses.size());
+    pxr::WorkParallelForN(firstUses.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            headers[i] = readImageHeader(uses[firstUses[i]].resolvedPath);
+        }
+    });
+
+    for (size_t i = 0; i < firstUses.size(); ++i) {
+        const ShaderTextureUse& use = uses[firstUses[i]];
+        const std::string input = use.shader.GetPath().GetString() + ".inputs:" + use.inputName.GetString();
+        const ImageHeader& header = headers[i];
+        const std::string extension = imageHeader::extensionOf(use.resolvedPath);
+        const std::string expectedFormat = imageHeader::formatForExtension(extension);
+
+        if (header.format.empty()) {
+            errors.push_back("Unreadable or unrecognized texture " + use.assetPath + " at " + input);
+        } else if (!header.isValid()) {
+            errors.push_back("Texture " + use.assetPath + " at " + input + " has an invalid " + header.format +
+                             " header");
+        } else if (!expectedFormat.empty() && expectedFormat != header.format) {
+            errors.push_back("Texture format mismatch for " + use.assetPath + " at " + input + ": ." + extension +
+                             " extension but " + header.format + " data");
+        }
+    }
+
+    if (!errors.empty()) {
+        std::string errorMsg = "Texture validation failed with the following issues:\n";
+        for (const auto& err : errors) {
+            errorMsg += "- " + err + "\n";
+        }
+        return {"Validate Textures", false, errorMsg};
+    }
+
+    return {"Validate Textures", true, "All " + std::to_string(uses.size()) + " texture inputs resolve to " +
+                                       std::to_string(firstUses.size()) + " readable image files."};
+}
+
+/**
+ * @brief Returns the Sdf value type a shader registry property is declared with.
+ */
+pxr::SdfValueTypeName sdrPropertySdfType(const pxr::SdrShaderProperty& property) {
+#if PXR_VERSION >= 2405
+    return property.GetTypeAsSdfType().GetSdfType();
+#else
+    return property.GetTypeAsSdfType().first;
+#endif
+}
+
+/**
+ * @brief Shader registry definitions keyed by shader ID, null for IDs the registry does not know.
+ */
+using ShaderDefinitions = std::unordered_map<pxr::TfToken, pxr::SdrShaderNodeConstPtr, pxr::TfToken::HashFunctor>;
+
+/**
+ * @brief Fills in the registry definition of every ID in the map with one registry query per ID.
+ */
+void lookupShaderDefinitions(ShaderDefinitions& definitions) {
+    pxr::SdrRegistry& registry = pxr::SdrRegistry::GetInstance();
+    for (auto& [shaderId, definition] : definitions) {
+        definition = registry.GetShaderNodeByIdentifier(shaderId);
+    }
+}
+
+/**
+ * @brief Validates shader IDs and their authored inputs against the shader definition registry.
+ *
+ * For every shader implemented by an `info:id`, checks that:
+ * - The ID names a node known to the SdrRegistry.
+ * - Every authored input exists on that node's definition.
+ * - Each input's value type matches the definition, ignoring roles (so color3f matches float3)
+ *   and treating token and string as interchangeable.
+ *
+ * Registry lookups are cached per unique ID, so the number of registry queries equals the
+ * number of distinct IDs rather than the number of shaders. The per-shader input checks then
+ * run in parallel against the cached definitions. Shaders implemented by a source asset or
+ * source code are skipped.
+ *
+ * @param stage The USD stage to validate.
+ * @return TestResult Containing:
+ *         - Test name ("Validate Shader Definitions").
+ *         - Success/failure status.
+ *         - Detailed validation results or errors.
+ */
+TestResult validateShaderDefinitions(const pxr::UsdStageRefPtr& stage) {
+    if (!stage) {
+        return {"Validate Shader Definitions", false, "Invalid stage reference."};
+    }
+
+    std::vector<pxr::UsdShadeShader> shaders;
+    std::vector<pxr::TfToken> shaderIds;
+    ShaderDefinitions definitions;
+    for (auto prim : stage->Traverse()) {
+        pxr::UsdShadeShader shader(prim);
+        pxr::TfToken shaderId;
+        if (!shader || !shader.GetShaderId(&shaderId) || shaderId.IsEmpty()) {
+            continue;
+        }
+        shaders.push_back(shader);
+        shaderIds.push_back(shaderId);
+        definitions.emplace(shaderId, nullptr);
+    }
+
+    if (shaders.empty()) {
+        return {
+            "Validate Shader Definitions",
+            true,
+            "No shaders with an ID found in the scene, which is acceptable."
+        };
+    }
+
+    lookupShaderDefinitions(definitions);
+
+    std::vector<std::vector<std::string>> shaderErrors(shaders.size());
+
+    pxr::WorkParallelForN(shaders.size(), [&](size_t first, size_t last) {
+        for (size_t s = first; s < last; ++s) {
+            const std::string path = shaders[s].GetPath().GetString();
+            const pxr::SdrShaderNodeConstPtr definition = definitions.at(shaderIds[s]);
+            if (!definition) {
+                shaderErrors[s].push_back("Unknown shader ID '" + shaderIds[s].GetString() + "' at: " + path);
+                continue;
+            }
+
+            for (const auto& input : shaders[s].GetInputs()) {
+                const pxr::TfToken name = input.GetBaseName();
+                const pxr::SdrShaderPropertyConstPtr property = definition->GetShaderInput(name);
+                if (!property) {
+                    shaderErrors[s].push_back("Input '" + name.GetString() + "' at " + path +
+                                              " is not defined by '" + shaderIds[s].GetString() + "'");
+                    continue;
+                }
+
+                const pxr::SdfValueTypeName declared = sdrPropertySdfType(*property);
+                const pxr::SdfValueTypeName authored = input.GetTypeName();
+                const auto isText = [](const pxr::SdfValueTypeName& type) {
+                    return type == pxr::SdfValueTypeNames->Token || type == pxr::SdfValueTypeNames->String;
+                };
+                if (declared.GetType() != authored.GetType() && !(isText(declared) && isText(authored))) {
+                    shaderErrors[s].push_back("Input '" + name.GetString() + "' at " + path + " is " +
+                                              authored.GetAsToken().GetString() + " but '" +
+                                              shaderIds[s].GetString() + "' declares " +
+                                              declared.GetAsToken().GetString());
+                }
+            }
+        }
+    });
+
+    std::vector<std::string> errors;
+    for (const auto& messages : shaderErrors) {
+        errors.insert(errors.end(), messages.begin(), messages.end());
+    }
+
+    if (!errors.empty()) {
+        std::string errorMsg = "Shader definition validation failed with the following issues:\n";
+        for (const auto& err : errors) {
+            errorMsg += "- " + err + "\n";
+        }
+        return {"Validate Shader Definitions", false, errorMsg};
+    }
+
+    return {"Validate Shader Definitions", true, "All shaders match their registry definitions (" +
+                                                 std::to_string(shaders.size()) + " shaders, " +
+                                                 std::to_string(definitions.size()) + " distinct IDs)."};
+}
+
+/**
+ * @brief Mixes a value into a running hash.
+ */
+inline void hashCombine(size_t& seed, size_t value) {
+    seed ^= value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+}
+
+/**
+ * @brief Computes a structural hash of a material network that ignores prim names.
+ *
+ * Each node hashes its type, authored attribute names, value types and default values, and for
+ * every connection the attribute it reads from and the hash of the node producing it. Material
+ * outputs are then hashed with their upstream nodes, followed by the sorted hashes of all nodes
+ * so that unconnected nodes still count. Two materials share a hash when their node IDs, input
+ * values and topology match, however their shaders are named or ordered in namespace.
+ *
+ * Networks with cycles are the exception: the node a cycle is entered from hashes the back edge
+ * as a constant, and which node that is depends on namespace order. Identical cyclic networks
+ * may therefore hash differently, which only hides duplicates; a shared hash is confirmed with
+ * sameMaterialNetwork() before materials are treated as identical.
+ */
+size_t hashMaterialNetwork(const MaterialNetwork& network) {
+    // Hash of the cycle breaker; cycles are reported by validateMaterialNetworks(), and make
+    // the hash depend on traversal order as described above
+    static constexpr size_t kCycleHash = 0x5bd1e995;
+
+    const size_t nodeCount = network.nodes.size();
+    std::vector<std::vector<size_t>> nodeConnections(nodeCount);
+    for (size_t c = 0; c < network.connections.size(); ++c) {
+        if (network.connections[c].node >= 0) {
+            nodeConnections[network.connections[c].node].push_back(c);
+        }
+    }
+
+    enum : uint8_t { kPending, kHashing, kHashed };
+    std::vector<uint8_t> state(nodeCount, kPending);
+    std::vector<size_t> nodeHashes(nodeCount, 0);
+
+    std::function<size_t(int)> hashNode;
+    // What a connection reads: a node's property, the material's interface, or a path outside the network
+    auto hashSource = [&](const NetworkConnection& connection) {
+        size_t seed = connection.source.GetNameToken().Hash();
+        if (connection.sourceNode >= 0) {
+            hashCombine(seed, hashNode(connection.sourceNode));
+        } else if (connection.source.GetPrimPath() == network.material.GetPath()) {
+            hashCombine(seed, std::hash<std::string>()("interface"));
+        } else {
+            hashCombine(seed, std::hash<std::string>()(connection.source.GetString()));
+        }
+        return seed;
+    };
+
+    hashNode = [&](int node) -> size_t {
+        if (state[node] == kHashing) {
+            return kCycleHash;
+        }
+        if (state[node] == kHashed) {
+            return nodeHashes[node];
+        }
+        state[node] = kHashing;
+
+        size_t seed = network.nodes[node].GetTypeName().Hash();
+        for (const auto& attribute : network.nodes[node].GetAuthoredAttributes()) {
+            hashCombine(seed, attribute.GetName().Hash());
+            hashCombine(seed, attribute.GetTypeName().GetAsToken().Hash());
+            pxr::VtValue value;
+            if (attribute.Get(&value)) {
+                hashCombine(seed, value.GetHash());
+            }
+        }
+        for (size_t c : nodeConnections[node]) {
+            hashCombine(seed, network.connections[c].attribute.GetName().Hash());
+            hashCombine(seed, hashSource(network.connections[c]));
+        }
+
+        state[node] = kHashed;
+        nodeHashes[node] = seed;
+        return seed;
+    };
+
+    size_t seed = 0;
+    for (const auto& attribute : network.material.GetAuthoredAttributes()) {
+        hashCombine(seed, attribute.GetName().Hash());
+        pxr::VtValue value;
+        if (attribute.Get(&value)) {
+            hashCombine(seed, value.GetHash());
+        }
+    }
+    for (const auto& connection : network.connections) {
+        if (connection.node < 0) {
+            hashCombine(seed, connection.attribute.GetName().Hash());
+            hashCombine(seed, hashSource(connection));
+        }
+    }
+
+    std::vector<size_t> sortedHashes(nodeCount);
+    for (size_t i = 0; i < nodeCount; ++i) {
+        sortedHashes[i] = hashNode(static_cast<int>(i));
+    }
+    std::sort(sortedHashes.begin(), sortedHashes.end());
+    for (size_t hash : sortedHashes) {
+        hashCombine(seed, hash);
+    }
+    return seed;
+}
+
+/**
+ * @brief Returns true if two material networks are structurally identical, ignoring prim names.
+ *
+ * Nodes are paired by following connections from the material outputs, then unconnected nodes
+ * are paired with any remaining node they match. Paired nodes must have the same type, the same
+ * authored attribute names, value types and default values, and connections that read the same
+ * property from paired nodes, from the material interface, or from the same outside path. The
+ * pairing does not backtrack, so ambiguous unconnected nodes can only make identical networks
+ * compare unequal, never the reverse.
+ */
+bool sameMaterialNetwork(const MaterialNetwork& a, const MaterialNetwork& b) {
+    const size_t nodeCount = a.nodes.size();
+    if (nodeCount != b.nodes.size() || a.connections.size() != b.connections.size()) {
+        return false;
+    }
+
+    auto sameAttributes = [](const pxr::UsdPrim& primA, const pxr::UsdPrim& primB, bool compareTypes) {
+        const std::vector<pxr::UsdAttribute> attributesA = primA.GetAuthoredAttributes();
+        const std::vector<pxr::UsdAttribute> attributesB = primB.GetAuthoredAttributes();
+        if (attributesA.size() != attributesB.size()) {
+            return false;
+        }
+        for (size_t i = 0; i < attributesA.size(); ++i) {
+            if (attributesA[i].GetName() != attributesB[i].GetName() ||
+                (compareTypes && attributesA[i].GetTypeName() != attributesB[i].GetTypeName())) {
+                return false;
+            }
+            pxr::VtValue valueA, valueB;
+            const bool hasA = attributesA[i].Get(&valueA);
+            if (hasA != attributesB[i].Get(&valueB) || (hasA && !(valueA == valueB))) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    auto connectionsOf = [nodeCount](const MaterialNetwork& network) {
+        std::vector<std::vector<size_t>> nodeConnections(nodeCount);
+        for (size_t c = 0; c < network.connections.size(); ++c) {
+            if (network.connections[c].node >= 0) {
+                nodeConnections[network.connections[c].node].push_back(c);
+            }
+        }
+        return nodeConnections;
+    };
+    const std::vector<std::vector<size_t>> connectionsA = connectionsOf(a);
+    const std::vector<std::vector<size_t>> connectionsB = connectionsOf(b);
+
+    // A pair is recorded before its connections are checked, so cycles close on themselves
+    std::vector<int> pairOfA(nodeCount, -1);
+    std::vector<int> pairOfB(nodeCount, -1);
+
+    std::function<bool(int, int)> pairNodes;
+    auto sameSource = [&](const NetworkConnection& connectionA, const NetworkConnection& connectionB) {
+        if (connectionA.attribute.GetName() != connectionB.attribute.GetName() ||
+            connectionA.source.GetNameToken() != connectionB.source.GetNameToken()) {
+            return false;
+        }
+        if (connectionA.sourceNode >= 0 || connectionB.sourceNode >= 0) {
+            return connectionA.sourceNode >= 0 && connectionB.sourceNode >= 0 &&
+                   pairNodes(connectionA.sourceNode, connectionB.sourceNode);
+        }
+        const bool interfaceA = connectionA.source.GetPrimPath() == a.material.GetPath();
+        const bool interfaceB = connectionB.source.GetPrimPath() == b.material.GetPath();
+        return interfaceA || interfaceB ? interfaceA && interfaceB : connectionA.source == connectionB.source;
+    };
+
+    pairNodes = [&](int nodeA, int nodeB) -> bool {
+        if (pairOfA[nodeA] >= 0 || pairOfB[nodeB] >= 0) {
+            return pairOfA[nodeA] == nodeB;
+        }
+        pairOfA[nodeA] = nodeB;
+        pairOfB[nodeB] = nodeA;
+
+        if (a.nodes[nodeA].GetTypeName() != b.nodes[nodeB].GetTypeName() ||
+            !sameAttributes(a.nodes[nodeA], b.nodes[nodeB], true) ||
+            connectionsA[nodeA].size() != connectionsB[nodeB].size()) {
+            return false;
+        }
+        for (size_t i = 0; i < connectionsA[nodeA].size(); ++i) {
+            if (!sameSource(a.connections[connectionsA[nodeA][i]], b.connections[connectionsB[nodeB][i]])) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    // Material outputs come first in both connection lists
+    if (!sameAttributes(a.material, b.material, false)) {
+        return false;
+    }
+    for (size_t c = 0; c < a.connections.size(); ++c) {
+        const bool outputA = a.connections[c].node < 0;
+        if (outputA != (b.connections[c].node < 0)) {
+            return false;
+        }
+        if (outputA && !sameSource(a.connections[c], b.connections[c])) {
+            return false;
+        }
+    }
+
+    // Nodes no output reaches are paired with the first remaining node they match
+    for (size_t nodeA = 0; nodeA < nodeCount; ++nodeA) {
+        if (pairOfA[nodeA] >= 0) {
+            continue;
+        }
+        bool paired = false;
+        for (size_t nodeB = 0; nodeB < nodeCount && !paired; ++nodeB) {
+            if (pairOfB[nodeB] >= 0) {
+                continue;
+            }
+            const std::vector<int> savedA = pairOfA;
+            const std::vector<int> savedB = pairOfB;
+            paired = pairNodes(static_cast<int>(nodeA), static_cast<int>(nodeB));
+            if (!paired) {
+                pairOfA = savedA;
+                pairOfB = savedB;
+            }
+        }
+        if (!paired) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Finds materials whose shading networks are structurally identical.
+ *
+ * Every material's network, taken from the run's shared MaterialNetworkCache, is reduced to a
+ * structural hash with hashMaterialNetwork(), in parallel across materials. A material joins a
+ * group only when its hash matches and sameMaterialNetwork() confirms it against the group's
+ * first member, so hash collisions never merge different materials. Each group beyond its first member is a
+ * shader compile the renderer could skip by binding one shared material instead.
+ *
+ * @param stage The USD stage to validate.
+ * @param networks The run's material network cache, so each material is visited once per run.
+ * @return TestResult Containing:
+ *         - Test name ("Validate Material Duplicates").
+ *         - Success/failure status.
+ *         - The duplicate groups and the number of avoidable shader compiles.
+ */
+TestResult validateMaterialDuplicates(const pxr::UsdStageRefPtr& stage, MaterialNetworkCache& networks) {
+    if (!stage) {
+        return {"Validate Material Duplicates", false, "Invalid stage reference."};
+    }
+
+    // Number of materials named per duplicate group in the report
+    static constexpr size_t kMaxListed = 5;
+
+    const std::vector<MaterialNetwork>& materialNetworks = networks.get(stage);
+    if (materialNetworks.empty()) {
+        return {
+            "Validate Material Duplicates",
+            true,
+            "No materials found in the scene, which is acceptable."
+        };
+    }
+
+    const size_t materialCount = materialNetworks.size();
+    std::vector<size_t> hashes(materialCount);
+    pxr::WorkParallelForN(materialCount, [&](size_t first, size_t last) {
+        for (size_t m = first; m < last; ++m) {
+            hashes[m] = hashMaterialNetwork(materialNetworks[m]);
+        }
+    });
+
+    // Groups keep the traversal order of their first member; a hash may hold several groups
+    std::unordered_map<size_t, std::vector<size_t>> groupsOfHash;
+    std::vector<std::vector<size_t>> groups;
+    for (size_t m = 0; m < materialCount; ++m) {
+        std::vector<size_t>& candidates = groupsOfHash[hashes[m]];
+        auto found = std::find_if(candidates.begin(), candidates.end(), [&](size_t group) {
+            return sameMaterialNetwork(materialNetworks[groups[group].front()], materialNetworks[m]);
+        });
+        if (found == candidates.end()) {
+            found = candidates.insert(candidates.end(), groups.size());
+            groups.emplace_back();
+        }
+        groups[*found].push_back(m);
+    }
+
+    const size_t avoidable = materialCount - groups.size();
+    if (avoidable == 0) {
+        return {"Validate Material Duplicates", true, "All " + std::to_string(materialCount) +
+                                                      " materials have structurally distinct networks."};
+    }
+
+    std::string errorMsg = "Material duplicate validation failed with the following issues:\n";
+    errorMsg += "- " + std::to_string(avoidable) + " of " + std::to_string(materialCount) +
+                " shader compiles could be avoided by sharing identical materials\n";
+    for (const auto& group : groups) {
+        if (group.size() < 2) {
+            continue;
+        }
+        std::string line = "- " + std::to_string(group.size()) + " identical materials: ";
+        for (size_t i = 0; i < group.size() && i < kMaxListed; ++i) {
+            line += (i ? ", " : "") + materialNetworks[group[i]].material.GetPath().GetString();
+        }
+        if (group.size() > kMaxListed) {
+            line += " and " + std::to_string(group.size() - kMaxListed) + " more";
+        }
+        errorMsg += line + "\n";
+    }
+    return {"Validate Material Duplicates", false, errorMsg};
+}
+
+/**
+ * @brief Detects materials nothing binds to and shader nodes no material output reaches.
+ *
+ * A single parallel pass over the traversed prims builds a reverse index from each material
+ * to the binding relationships that target it. Every material's network comes from the run's
+ * shared MaterialNetworkCache, and reachableNodes() flags the nodes reachable from its outputs.
+ * Reports:
+ * - Materials no direct or collection-based binding targets, once the scene authors any
+ *   bindings at all, so material libraries without bindings are not flagged.
+ * - Shader and node graph nodes of a material that do not feed any of its outputs.
+ *
+ * Each orphan is reported with the bytes it holds: the values of its authored attributes, plus
+ * the uncompressed mip chain of any texture that no live shader also loads. Shaders outside
+ * any material are left to validateShaders().
+ *
+ * @param stage The USD stage to validate.
+ * @param networks The run's material network cache, so each material is visited once per run.
+ * @return TestResult Containing:
+ *         - Test name ("Validate Orphaned Shading").
+ *         - Success/failure status.
+ *         - The orphaned materials and nodes with the bytes they contribute.
+ */
+TestResult validateOrphanedShading(const pxr::UsdStageRefPtr& stage, MaterialNetworkCache& networks) {
+    if (!stage) {
+        return {"Validate Orphaned Shading", false, "Invalid stage reference."};
+    }
+
+    std::vector<pxr::UsdPrim> prims;
+    for (auto prim : stage->Traverse()) {
+        prims.push_back(prim);
+    }
+
+    std::vector<pxr::SdfPathVector> primBindingTargets(prims.size());
+    std::vector<uint8_t> primHasBinding(prims.size(), 0);
+    const std::string kBindingPrefix = "material:binding";
+
+    pxr::WorkParallelForN(prims.size(), [&](size_t first, size_t last) {
+        for (size_t p = first; p < last; ++p) {
+            for (const auto& rel : prims[p].GetAuthoredRelationships()) {
+                if (rel.GetName().GetString().compare(0, kBindingPrefix.size(), kBindingPrefix) != 0) {
+                    continue;
+                }
+                primHasBinding[p] = 1;
+                pxr::SdfPathVector targets;
+                rel.GetTargets(&targets);
+                for (const auto& target : targets) {
+                    if (target.IsPrimPath()) {
+                        primBindingTargets[p].push_back(target);
+                    }
+                }
+            }
+        }
+    });
+
+    const std::vector<MaterialNetwork>& materialNetworks = networks.get(stage);
+    std::vector<std::vector<bool>> materialReached(materialNetworks.size());
+    pxr::WorkParallelForN(materialNetworks.size(), [&](size_t first, size_t last) {
+        for (size_t m = first; m < last; ++m) {
+            materialReached[m] = reachableNodes(materialNetworks[m]);
+        }
+    });
+
+    std::unordered_map<pxr::SdfPath, size_t, pxr::SdfPath::Hash> bindingsOfMaterial;
+    bool foundAnyBinding = false;
+    for (size_t p = 0; p < prims.size(); ++p) {
+        foundAnyBinding |= primHasBinding[p] != 0;
+        for (const auto& target : primBindingTargets[p]) {
+            ++bindingsOfMaterial[target];
+        }
+    }
+    const size_t materialCount = materialNetworks.size();
+
+    if (materialCount == 0) {
+        return {
+            "Validate Orphaned Shading",
+            true,
+            "No materials found in the scene, which is acceptable."
+        };
+    }
+
+    // An orphan is an unbound material with its whole network, or a single unreachable node
+    struct Orphan {
+        pxr::UsdPrim prim;
+        bool isMaterial;
+        std::vector<pxr::UsdPrim> prims;  // Every prim whose attributes and textures it holds
+        uint64_t bytes = 0;
+    };
+    std::vector<Orphan> orphans;
+    std::vector<pxr::UsdPrim> liveNodes;
+    for (size_t m = 0; m < materialCount; ++m) {
+        const MaterialNetwork& network = materialNetworks[m];
+        if (foundAnyBinding && bindingsOfMaterial.count(network.material.GetPath()) == 0) {
+            Orphan orphan{network.material, true, {network.material}};
+            orphan.prims.insert(orphan.prims.end(), network.nodes.begin(), network.nodes.end());
+            orphans.push_back(std::move(orphan));
+            continue;
+        }
+        for (size_t i = 0; i < network.nodes.size(); ++i) {
+            if (materialReached[m][i]) {
+                liveNodes.push_back(network.nodes[i]);
+            } else {
+                orphans.push_back({network.nodes[i], false, {network.nodes[i]}});
+            }
+        }
+    }
+
+    if (orphans.empty()) {
+        return {"Validate Orphaned Shading", true,
+                foundAnyBinding
+                    ? "All " + std::to_string(materialCount) +
+                          " materials are bound and all their shader nodes feed a material output."
+                    : "All shader nodes of the " + std::to_string(materialCount) +
+                          " materials feed a material output; no material bindings found, so material use was not checked."};
+    }
+
+    // Texture path inputs are charged by the texture they load rather than by their path
+    pxr::WorkParallelForN(orphans.size(), [&](size_t first, size_t last) {
+        for (size_t o = first; o < last; ++o) {
+            for (const auto& prim : orphans[o].prims) {
+                for (const auto& attr : prim.GetAuthoredAttributes()) {
+                    if (attr.GetTypeName().GetScalarType() != pxr::SdfValueTypeNames->Asset &&
+                        !isStringTextureInput(attr)) {
+                        orphans[o].bytes += attributeValueBytes(attr);
+                    }
+                }
+            }
+        }
+    });
+
+    std::unordered_set<std::string> liveTextures;
+    for (const auto& use : collectShaderTextures(liveNodes)) {
+        liveTextures.insert(use.resolvedPath);
+    }
+    std::vector<pxr::UsdPrim> orphanedPrims;
+    std::unordered_map<pxr::SdfPath, size_t, pxr::SdfPath::Hash> orphanOfPrim;
+    for (size_t o = 0; o < orphans.size(); ++o) {
+        for (const auto& prim : orphans[o].prims) {
+            orphanOfPrim[prim.GetPath()] = o;
+            orphanedPrims.push_back(prim);
+        }
+    }
+    // Each dead texture is probed once and charged to its first orphaned user
+    std::vector<std::string> texturePaths;
+    std::vector<size_t> textureOwners;
+    for (const auto& use : collectShaderTextures(orphanedPrims)) {
+        if (use.resolvedPath.empty() || !liveTextures.insert(use.resolvedPath).second) {
+            continue;
+        }
+        texturePaths.push_back(use.resolvedPath);
+        textureOwners.push_back(orphanOfPrim.at(use.shader.GetPath()));
+    }
+    std::vector<uint64_t> textureBytes(texturePaths.size(), 0);
+    pxr::WorkParallelForN(texturePaths.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            textureBytes[i] = readImageHeader(texturePaths[i]).mipChainByteSize();
+        }
+    });
+    for (size_t i = 0; i < texturePaths.size(); ++i) {
+        orphans[textureOwners[i]].bytes += textureBytes[i];
+    }
+
+    size_t unusedMaterials = 0;
+    uint64_t totalBytes = 0;
+    for (const auto& orphan : orphans) {
+        unusedMaterials += orphan.isMaterial ? 1 : 0;
+        totalBytes += orphan.bytes;
+    }
+
+    std::string errorMsg = "Orphaned shading validation failed with the following issues:\n";
+    errorMsg += "- " + std::to_string(unusedMaterials) + " unused materials and " +
+                std::to_string(orphans.size() - unusedMaterials) + " unreachable shader nodes hold " +
+                formatBytes(totalBytes) + "\n";
+    for (const auto& orphan : orphans) {
+        errorMsg += std::string("- ") + (orphan.isMaterial ? "Unused material: " : "Unreachable shader node: ") +
+                    orphan.prim.GetPath().GetString() + " (" + formatBytes(orphan.bytes) + ")\n";
+    }
+    return {"Validate Orphaned Shading", false, errorMsg};
+}
+
+/**
+ * @brief How safely a connection carries a value from its source type to its destination type.
+ */
+enum class TypeCompatibility { kCompatible, kLossy, kIncompatible };
+
+/**
+ * @brief Looks up the compatibility of a connection from a source to a destination value type.
+ *
+ * Roles are ignored, so color3f, normal3f and float3 are interchangeable, and token and string
+ * are interchangeable. Between numeric types, the table is precomputed once from each type's
+ * component count and precision:
+ * - Dropping components (float3 to float, float4 to color3f) is lossy.
+ * - Adding components (float to color3f) is incompatible, since it needs a conversion node.
+ * - Narrowing precision (double to float, float to half, float to int) is lossy.
+ * Any other pair of distinct types, such as asset to color3f, is incompatible.
+ */
+TypeCompatibility connectionCompatibility(const pxr::SdfValueTypeName& source,
+                                          const pxr::SdfValueTypeName& destination) {
+    enum Kind { kInteger, kReal, kText, kOther };
+    struct ValueClass {
+        pxr::SdfValueTypeName type;
+        Kind kind;
+        int components;
+        int precision;  // Bytes per component, 0 for bool
+    };
+    using Table = std::pair<std::unordered_map<std::string, size_t>, std::vector<std::vector<TypeCompatibility>>>;
+
+    static const Table table = [] {
+        const auto& names = *pxr::SdfValueTypeNames;
+        const std::vector<ValueClass> classes = {
+            {names.Bool, kInteger, 1, 0},   {names.UChar, kInteger, 1, 1},  {names.Int, kInteger, 1, 4},
+            {names.UInt, kInteger, 1, 4},   {names.Int64, kInteger, 1, 8},  {names.UInt64, kInteger, 1, 8},
+            {names.Int2, kInteger, 2, 4},   {names.Int3, kInteger, 3, 4},   {names.Int4, kInteger, 4, 4},
+            {names.Half, kReal, 1, 2},      {names.Float, kReal, 1, 4},     {names.Double, kReal, 1, 8},
+            {names.Half2, kReal, 2, 2},     {names.Float2, kReal, 2, 4},    {names.Double2, kReal, 2, 8},
+            {names.Half3, kReal, 3, 2},     {names.Float3, kReal, 3, 4},    {names.Double3, kReal, 3, 8},
+            {names.Half4, kReal, 4, 2},     {names.Float4, kReal, 4, 4},    {names.Double4, kReal, 4, 8},
+            {names.Token, kText, 1, 0},     {names.String, kText, 1, 0},    {names.Asset, kOther, 1, 0},
+            {names.Matrix2d, kOther, 4, 8}, {names.Matrix3d, kOther, 9, 8}, {names.Matrix4d, kOther, 16, 8},
+        };
+
+        Table built;
+        auto& [indices, matrix] = built;
+        matrix.assign(classes.size(), std::vector<TypeCompatibility>(classes.size(), TypeCompatibility::kIncompatible));
+        for (size_t s = 0; s < classes.size(); ++s) {
+            indices.emplace(classes[s].type.GetType().GetTypeName(), s);
+            for (size_t d = 0; d < classes.size(); ++d) {
+                const ValueClass& from = classes[s];
+                const ValueClass& to = classes[d];
+                TypeCompatibility& entry = matrix[s][d];
+                if (s == d || (from.kind == kText && to.kind == kText)) {
+                    entry = TypeCompatibility::kCompatible;
+                } else if (from.kind == kOther || to.kind == kOther || from.kind == kText || to.kind == kText ||
+                           from.components < to.components) {
+                    entry = TypeCompatibility::kIncompatible;
+                } else if (from.components > to.components || from.precision > to.precision ||
+                           (from.kind == kReal && to.kind == kInteger)) {
+                    entry = TypeCompatibility::kLossy;
+                } else {
+                    entry = TypeCompatibility::kCompatible;
+                }
+            }
+        }
+        return built;
+    }();
+
+    if (source.GetType() == destination.GetType()) {
+        return TypeCompatibility::kCompatible;
+    }
+    if (source.IsArray() != destination.IsArray()) {
+        return TypeCompatibility::kIncompatible;
+    }
+    const auto& [indices, matrix] = table;
+    auto from = indices.find(source.GetScalarType().GetType().GetTypeName());
+    auto to = indices.find(destination.GetScalarType().GetType().GetTypeName());
+    if (from == indices.end() || to == indices.end()) {
+        return TypeCompatibility::kIncompatible;
+    }
+    return matrix[from->second][to->second];
+}
+
+/**
+ * @brief Validates that every connection in each material network joins compatible value types.
+ *
+ * The destination type is the authored type of the connected input or output. The source type
+ * is the type the source node's shader definition declares for that property, looked up once
+ * per distinct shader ID, and otherwise the authored type of the source property, as for node
+ * graphs, the material's interface inputs and IDs the registry does not know. Definitions that
+ * declare no Sdf type (e.g. terminals, reported as token) also fall back to the authored type.
+ *
+ * Types are compared with connectionCompatibility(), and incompatible or lossy connections are
+ * reported. Materials are validated in parallel, on the networks of the run's shared
+ * MaterialNetworkCache.
+ *
+ * @param stage The USD stage to validate.
+ * @param networks The run's material network cache, so each material is visited once per run.
+ * @return TestResult Containing:
+ *         - Test name ("Validate Connection Types").
+ *         - Success/failure status.
+ *         - Detailed validation results or errors.
+ */
+TestResult validateConnectionTypes(const pxr::UsdStageRefPtr& stage, MaterialNetworkCache& networks) {
+    if (!stage) {
+        return {"Validate Connection Types", false, "Invalid stage reference."};
+    }
+
+    const std::vector<MaterialNetwork>& materialNetworks = networks.get(stage);
+    const size_t materialCount = materialNetworks.size();
+    if (materialCount == 0) {
+        return {
+            "Validate Connection Types",
+            true,
+            "No materials found in the scene, which is acceptable."
+        };
+    }
+
+    // Node IDs are read once per node, and each distinct ID is looked up in the registry once
+    std::vector<std::vector<pxr::TfToken>> nodeIds(materialCount);
+    ShaderDefinitions definitions;
+    for (size_t m = 0; m < materialCount; ++m) {
+        for (const auto& node : materialNetworks[m].nodes) {
+            pxr::TfToken shaderId;
+            if (pxr::UsdShadeShader shader = pxr::UsdShadeShader(node)) {
+                shader.GetShaderId(&shaderId);
+            }
+            if (!shaderId.IsEmpty()) {
+                definitions.emplace(shaderId, nullptr);
+            }
+            nodeIds[m].push_back(shaderId);
+        }
+    }
+    lookupShaderDefinitions(definitions);
+
+    std::vector<std::vector<std::string>> materialErrors(materialCount);
+    std::vector<size_t> materialConnections(materialCount, 0);
+
+    pxr::WorkParallelForN(materialCount, [&](size_t first, size_t last) {
+        for (size_t m = first; m < last; ++m) {
+            for (const auto& connection : materialNetworks[m].connections) {
+                pxr::UsdAttribute sourceAttr = stage->GetAttributeAtPath(connection.source);
+                if (!sourceAttr) {
+                    continue;  // Reported by validateMaterialNetworks()
+                }
+
+                pxr::SdfValueTypeName sourceType = sourceAttr.GetTypeName();
+                if (connection.sourceNode >= 0 && !nodeIds[m][connection.sourceNode].IsEmpty()) {
+                    const pxr::SdrShaderNodeConstPtr definition = definitions.at(nodeIds[m][connection.sourceNode]);
+                    const std::string& name = connection.source.GetNameToken().GetString();
+                    pxr::SdrShaderPropertyConstPtr property = nullptr;
+                    if (definition && name.compare(0, 8, "outputs:") == 0) {
+                        property = definition->GetShaderOutput(pxr::TfToken(name.substr(8)));
+                    } else if (definition && name.compare(0, 7, "inputs:") == 0) {
+                        property = definition->GetShaderInput(pxr::TfToken(name.substr(7)));
+                    }
+                    if (property) {
+                        const pxr::SdfValueTypeName declared = sdrPropertySdfType(*property);
+                        if (declared && declared != pxr::SdfValueTypeNames->Token) {
+                            sourceType = declared;
+                        }
+                    }
+                }
+
+                ++materialConnections[m];
+                const pxr::SdfValueTypeName destinationType = connection.attribute.GetTypeName();
+                const TypeCompatibility compatibility = connectionCompatibility(sourceType, destinationType);
+                if (compatibility != TypeCompatibility::kCompatible) {
+                    materialErrors[m].push_back(
+                        std::string(compatibility == TypeCompatibility::kLossy ? "Lossy" : "Incompatible") +
+                        " connection from " + connection.source.GetString() + " (" +
+                        sourceType.GetAsToken().GetString() + ") to " + connection.attribute.GetPath().GetString() +
+                        " (" + destinationType.GetAsToken().GetString() + ")");
+                }
+            }
+        }
+    });
+
+    std::vector<std::string> errors;
+    size_t connectionCount = 0;
+    for (size_t m = 0; m < materialCount; ++m) {
+        errors.insert(errors.end(), materialErrors[m].begin(), materialErrors[m].end());
+        connectionCount += materialConnections[m];
+    }
+
+    if (!errors.empty()) {
+        std::string errorMsg = "Connection type validation failed with the following issues:\n";
+        for (const auto& err : errors) {
+            errorMsg += "- " + err + "\n";
+        }
+        return {"Validate Connection Types", false, errorMsg};
+    }
+
+    return {"Validate Connection Types", true, "All " + std::to_string(connectionCount) + " connections in " +
+                                               std::to_string(materialCount) +
+                                               " materials join compatible value types."};
+}
+
+/**
+ * @brief Estimates renderer texture memory per material, per model and for the scene, and checks budgets.
+ *
+ * Every texture referenced by a shader texture path input is probed once per resolved file by
+ * reading its image header, and charged its full mip chain: width x height x channels x bit
+ * depth, summed over every level down to 1x1. Textures are deduplicated by resolved path for
+ * the scene total, within each material and within each model (including its descendant
+ * models), so a file shared by several users is only counted once at each level. Shaders are
+ * attributed to their nearest enclosing material and model. UDIM tile sets are not probed.
+ *
+ * Fails when the scene total exceeds TestConfig::maxTextureBytes, any material exceeds
+ * TestConfig::maxMaterialTextureBytes, or any model, counting the textures of its descendant
+ * models, exceeds TestConfig::maxModelTextureBytes (0 means unlimited).
+ *
+ * @param stage The USD stage to validate.
+ * @param config The configuration holding the texture memory budgets.
+ * @param hierarchies The run's model hierarchy cache, so the stage is traversed once per run.
+ * @return TestResult Containing:
+ *         - Test name ("Validate Texture Memory").
+ *         - Success/failure status.
+ *         - The largest materials and models, or budget overrun details.
+ */
+TestResult validateTextureMemory(const pxr::UsdStageRefPtr& stage, const TestConfig& config,
+                                 ModelHierarchyCache& hierarchies) {
+    if (!stage) {
+        return {"Validate Texture Memory", false, "Invalid stage reference."};
+    }
+
+    // Number of largest materials named in the report
+    static constexpr size_t kMaxListed = 5;
+
+    const ModelHierarchy& hierarchy = hierarchies.get(stage);
+    const std::vector<ShaderTextureUse> uses = collectShaderTextures(hierarchy.prims);
+    if (uses.empty()) {
+        return {
+            "Validate Texture Memory",
+            true,
+            "No texture assets found in the scene, which is acceptable."
+        };
+    }
+
+    // Nearest enclosing material of each prim; parents precede children in traversal order
+    std::vector<pxr::UsdPrim> materials;
+    std::vector<int> primMaterials(hierarchy.prims.size(), -1);
+    std::unordered_map<pxr::SdfPath, size_t, pxr::SdfPath::Hash> primIndices;
+    for (size_t i = 0; i < hierarchy.prims.size(); ++i) {
+        primIndices[hierarchy.prims[i].GetPath()] = i;
+        if (hierarchy.prims[i].IsA<pxr::UsdShadeMaterial>()) {
+            primMaterials[i] = static_cast<int>(materials.size());
+            materials.push_back(hierarchy.prims[i]);
+        } else if (hierarchy.primParents[i] >= 0) {
+            primMaterials[i] = primMaterials[hierarchy.primParents[i]];
+        }
+    }
+
+    // Unique resolved textures, and the set each material and model loads
+    std::unordered_map<std::string, size_t> textureIndices;
+    std::vector<std::string> texturePaths;
+    std::vector<std::set<size_t>> materialTextures(materials.size());
+    std::vector<std::set<size_t>> modelTextures(hierarchy.models.size());
+    for (const auto& use : uses) {
+        if (use.resolvedPath.empty() || use.assetPath.find("<UDIM>") != std::string::npos) {
+            continue;
+        }
+        auto [found, inserted] = textureIndices.emplace(use.resolvedPath, texturePaths.size());
+        if (inserted) {
+            texturePaths.push_back(use.resolvedPath);
+        }
+        const size_t prim = primIndices.at(use.shader.GetPath());
+        if (primMaterials[prim] >= 0) {
+            materialTextures[primMaterials[prim]].insert(found->second);
+        }
+        for (int model = hierarchy.primModels[prim]; model >= 0; model = hierarchy.modelParents[model]) {
+            modelTextures[model].insert(found->second);
+        }
+    }
+
+    std::vector<uint64_t> textureBytes(texturePaths.size(), 0);
+    pxr::WorkParallelForN(texturePaths.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            textureBytes[i] = readImageHeader(texturePaths[i]).mipChainByteSize();
+        }
+    });
+
+    auto sumBytes = [&textureBytes](const std::set<size_t>& textures) {
+        uint64_t bytes = 0;
+        for (size_t texture : textures) {
+            bytes += textureBytes[texture];
+        }
+        return bytes;
+    };
+    uint64_t totalBytes = 0;
+    for (uint64_t bytes : textureBytes) {
+        totalBytes += bytes;
+    }
+    std::vector<uint64_t> materialBytes(materials.size());
+    for (size_t m = 0; m < materials.size(); ++m) {
+        materialBytes[m] = sumBytes(materialTextures[m]);
+    }
+
+    std::vector<std::string> errors;
+    if (config.maxTextureBytes > 0 && totalBytes > config.maxTextureBytes) {
+        errors.push_back("Estimated texture memory of " + formatBytes(totalBytes) + " exceeds the budget of " +
+                         formatBytes(config.maxTextureBytes));
+    }
+    if (config.maxMaterialTextureBytes > 0) {
+        for (size_t m = 0; m < materials.size(); ++m) {
+            if (materialBytes[m] > config.maxMaterialTextureBytes) {
+                errors.push_back("Material " + materials[m].GetPath().GetString() + " loads " +
+                                 formatBytes(materialBytes[m]) + " of textures, exceeding the per-material budget of " +
+                                 formatBytes(config.maxMaterialTextureBytes));
+            }
+        }
+    }
+    if (config.maxModelTextureBytes > 0) {
+        for (size_t i = 0; i < hierarchy.models.size(); ++i) {
+            const uint64_t modelBytes = sumBytes(modelTextures[i]);
+            if (modelBytes > config.maxModelTextureBytes) {
+                errors.push_back("Model " + hierarchy.models[i].GetPath().GetString() + " loads " +
+                                 formatBytes(modelBytes) + " of textures, exceeding the per-model budget of " +
+                                 formatBytes(config.maxModelTextureBytes));
+            }
+        }
+    }
+
+    if (!errors.empty()) {
+        std::string errorMsg = "Texture memory estimate exceeded the configured budget:\n";
+        for (const auto& err : errors) {
+            errorMsg += "- " + err + "\n";
+        }
+        return {"Validate Texture Memory", false, errorMsg};
+    }
+
+    std::string message = "Estimated texture memory is " + formatBytes(totalBytes) + " for " +
+                          std::to_string(texturePaths.size()) + " unique texture files, including mip chains.";
+    std::vector<size_t> largest;
+    for (size_t m = 0; m < materials.size(); ++m) {
+        if (materialBytes[m] > 0) {
+            largest.push_back(m);
+        }
+    }
+    std::stable_sort(largest.begin(), largest.end(), [&materialBytes](size_t a, size_t b) {
+        return materialBytes[a] > materialBytes[b];
+    });
+    bool listed = false;
+    for (size_t i = 0; i < largest.size() && i < kMaxListed; ++i) {
+        message += std::string(listed ? "" : "\n") + "- Material " + materials[largest[i]].GetPath().GetString() +
+                   ": " + formatBytes(materialBytes[largest[i]]) + "\n";
+        listed = true;
+    }
+    for (size_t i = 0; i < hierarchy.models.size(); ++i) {
+        if (hierarchy.modelParents[i] >= 0) {
+            continue;
+        }
+        pxr::TfToken kind;
+        pxr::UsdModelAPI(hierarchy.models[i]).GetKind(&kind);
+        message += std::string(listed ? "" : "\n") + "- Model " + hierarchy.models[i].GetPath().GetString() +
+                   " (" + kind.GetString() + "): " + formatBytes(sumBytes(modelTextures[i])) + "\n";
+        listed = true;
+    }
+
+    return {"Validate Texture Memory", true, message};
+}
+
+/**
+ * @brief Validates that every relationship target and attribute connection in a USD file exists.
+ *
+ * Covers all authored relationships (e.g. proxyPrim, material:binding, skel:skeleton,
+ * collection includes, instancer prototypes) and all authored attribute connections on the
+ * traversed prims. Targets are gathered in parallel into one batch, sorted and deduplicated.
+ * Each distinct prim they name is then looked up on the stage once, in parallel, so overs,
+ * classes, inactive prims and instance proxies are all found, and property targets are checked
+ * on that prim. A collection path (e.g. "/Geom.collection:highlight") exists when the prim has
+ * that collection's properties.
+ *
+ * @param stage The USD stage to validate.
+ * @return TestResult Containing:
+ *         - Test name ("Validate Targets").
+ *         - Success/failure status.
+ *         - Detailed validation results or errors.
+ */
+TestResult validateTargets(const pxr::UsdStageRefPtr& stage) {
+    if (!stage) {
+        return {"Validate Targets", false, "Invalid stage reference."};
+    }
+
+    struct TargetUse {
+        pxr::SdfPath owner;   // The relationship or connected attribute
+        pxr::SdfPath target;
+        bool isConnection;
+    };
+
+    std::vector<pxr::UsdPrim> prims;
+    for (auto prim : stage->Traverse()) {
+        prims.push_back(prim);
+    }
+
+    std::vector<std::vector<TargetUse>> primUses(prims.size());
+    pxr::WorkParallelForN(prims.size(), [&](size_t first, size_t last) {
+        for (size_t p = first; p < last; ++p) {
+            for (const auto& rel : prims[p].GetAuthoredRelationships()) {
+                pxr::SdfPathVector targets;
+                rel.GetTargets(&targets);
+                for (const auto& target : targets) {
+                    primUses[p].push_back({rel.GetPath(), target, false});
+                }
+            }
+            for (const auto& attr : prims[p].GetAuthoredAttributes()) {
+                pxr::SdfPathVector sources;
+                if (attr.HasAuthoredConnections() && attr.GetConnections(&sources)) {
+                    for (const auto& source : sources) {
+                        primUses[p].push_back({attr.GetPath(), source, true});
+                    }
+                }
+            }
+        }
+    });
+
+    std::vector<TargetUse> uses;
+    for (auto& used : primUses) {
+        uses.insert(uses.end(), std::make_move_iterator(used.begin()), std::make_move_iterator(used.end()));
+    }
+
+    if (uses.empty()) {
+        return {
+            "Validate Targets",
+            true,
+            "No relationship targets or attribute connections found in the scene, which is acceptable."
+        };
+    }
+
+    // One sorted batch of distinct targets, and of the distinct prims they name
+    std::vector<pxr::SdfPath> targets;
+    targets.reserve(uses.size());
+    for (const auto& use : uses) {
+        targets.push_back(use.target);
+    }
+    std::sort(targets.begin(), targets.end());
+    targets.erase(std::unique(targets.begin(), targets.end()), targets.end());
+
+    std::vector<pxr::SdfPath> primPaths;
+    primPaths.reserve(targets.size());
+    for (const auto& target : targets) {
+        primPaths.push_back(target.GetPrimPath());
+    }
+    std::sort(primPaths.begin(), primPaths.end());
+    primPaths.erase(std::unique(primPaths.begin(), primPaths.end()), primPaths.end());
+
+    std::vector<pxr::UsdPrim> targetPrims(primPaths.size());
+    pxr::WorkParallelForN(primPaths.size(), [&](size_t first, size_t last) {
+        for (size_t i = first; i < last; ++i) {
+            targetPrims[i] = stage->GetPrimAtPath(primPaths[i]);
+        }
+    });
+
+    std::vector<uint8_t> exists(targets.size(), 0);
+    pxr::WorkParallelForN(targets.size(), [&](size_t first, size_t last) {
+        for (size_t t = first; t < last; ++t) {
+            const pxr::SdfPath primPath = targets[t].GetPrimPath();
+            const pxr::UsdPrim& prim =
+                targetPrims[std::lower_bound(primPaths.begin(), primPaths.end(), primPath) - primPaths.begin()];
+            if (!prim) {
+                continue;
+            }
+            if (!targets[t].IsPropertyPath()) {
+                exists[t] = 1;
+                continue;
+            }
+            const std::string& name = targets[t].GetNameToken().GetString();
+            if (name.compare(0, 11, "collection:") == 0) {
+                exists[t] = prim.HasProperty(pxr::TfToken(name + ":expansionRule")) ||
+                            prim.HasProperty(pxr::TfToken(name + ":includes"));
+            } else {
+                exists[t] = prim.HasProperty(targets[t].GetNameToken());
+            }
+        }
+    });
+
+    std::vector<std::string> errors;
+    size_t relationshipTargets = 0;
+    for (const auto& use : uses) {
+        relationshipTargets += use.isConnection ? 0 : 1;
+        const size_t t = std::lower_bound(targets.begin(), targets.end(), use.target) - targets.begin();
+        if (!exists[t]) {
+            errors.push_back(std::string(use.isConnection ? "Dangling connection at " : "Dangling relationship target at ") +
+                             use.owner.GetString() + ": " + use.target.GetString());
+        }
+    }
+
+    if (!errors.empty()) {
+        std::string errorMsg = "Target validation failed with the following issues:\n";
+        for (const auto& err : errors) {
+            errorMsg += "- " + err + "\n";
+        }
+        return {"Validate Targets", false, errorMsg};
+    }
+
+    return {"Validate Targets", true, "All " + std::to_string(relationshipTargets) + " relationship targets and " +
+                                      std::to_string(uses.size() - relationshipTargets) +
+                                      " attribute connections resolve."};
+}
+
+/**
+ * @brief Validates the membership of every collection in a USD file.
+ *
+ * Each UsdCollectionAPI's membership query is computed once through the shared
+ * CollectionMembershipCache, in parallel across the prims that own collections, and shared with
+ * other tests that resolve collections, such as validateMaterialBindings(). Reports:
+ * - Include targets that match nothing, i.e. neither an existing prim or property nor another
+ *   collection.
+ * - Exclude targets that match nothing: missing paths, or paths the collection would not
+ *   include anyway, so the exclude has no effect. This is decided from the collection's
+ *   computed membership query, so includeRoot and the rules of included collections count.
+ *   A path excluded both here and by an included collection is not reported.
+ * - Collections whose membership resolves to no prims.
+ *
+ * @param stage The USD stage to validate.
+ * @param collections The collection membership queries shared between tests.
+ * @return TestResult Containing:
+ *         - Test name ("Validate Collections").
+ *         - Success/failure status.
+ *         - Detailed validation results or errors.
+ */
+TestResult validateCollections(const pxr::UsdStageRefPtr& stage, CollectionMembershipCache& collections) {
+    if (!stage) {
+        return {"Validate Collections", false, "Invalid stage reference."};
+    }
+
+    std::vector<pxr::UsdPrim> prims;
+    for (auto prim : stage->Traverse()) {
+        prims.push_back(prim);
+    }
+
+    // A collection target exists when it names a prim, a property or another collection
+    auto targetExists = [&stage](const pxr::SdfPath& target) {
+        if (target.IsPrimPath()) {
+            return static_cast<bool>(stage->GetPrimAtPath(target));
+        }
+        pxr::TfToken collectionName;
+        if (pxr::UsdCollectionAPI::IsCollectionAPIPath(target, &collectionName)) {
+            return static_cast<bool>(pxr::UsdCollectionAPI::GetCollection(stage, target));
+        }
+        return static_cast<bool>(stage->GetPropertyAtPath(target));
+    };
+
+    // Whether a path would be a member without an exclude of it: the nearest rule above it decides
+    auto includedWithoutExclude = [](const pxr::UsdCollectionAPI::MembershipQuery& query, const pxr::SdfPath& path) {
+        const auto& rules = query.GetAsPathExpansionRuleMap();
+        for (pxr::SdfPath ancestor = path.GetParentPath(); !ancestor.IsEmpty(); ancestor = ancestor.GetParentPath()) {
+            auto found = rules.find(ancestor);
+            if (found != rules.end()) {
+                return found->second == pxr::UsdTokens->expandPrimsAndProperties ||
+                       (found->second == pxr::UsdTokens->expandPrims && path.IsPrimPath());
+            }
+        }
+        return false;
+    };
+
+    std::vector<std::vector<std::string>> primErrors(prims.size());
+    std::vector<size_t> primCollections(prims.size(), 0);
+    std::vector<size_t> primMembers(prims.size(), 0);
+
+    pxr::WorkParallelForN(prims.size(), [&](size_t first, size_t last) {
+        for (size_t p = first; p < last; ++p) {
+            for (const auto& collection : pxr::UsdCollectionAPI::GetAllCollections(prims[p])) {
+                ++primCollections[p];
+                const std::string name = collection.GetCollectionPath().GetString();
+                const pxr::UsdCollectionAPI::MembershipQuery& query = collections.get(collection);
+
+                pxr::SdfPathVector includes;
+                pxr::SdfPathVector excludes;
+                collection.GetIncludesRel().GetTargets(&includes);
+                collection.GetExcludesRel().GetTargets(&excludes);
+
+                for (const auto& include : includes) {
+                    if (!targetExists(include)) {
+                        primErrors[p].push_back("Include of " + include.GetString() + " in " + name +
+                                                " matches nothing");
+                    }
+                }
+                for (const auto& exclude : excludes) {
+                    // Excluding a path that is also included cancels that include
+                    const bool hasEffect = std::find(includes.begin(), includes.end(), exclude) != includes.end() ||
+                                           includedWithoutExclude(query, exclude);
+                    if (!targetExists(exclude) || !hasEffect) {
+                        primErrors[p].push_back("Exclude of " + exclude.GetString() + " in " + name +
+                                                " matches nothing");
+                    }
+                }
+
+                const std::set<pxr::SdfPath> members = pxr::UsdCollectionAPI::ComputeIncludedPaths(query, stage);
+                primMembers[p] += members.size();
+                if (members.empty()) {
+                    primErrors[p].push_back("Collection resolves to no prims: " + name);
+                }
+            }
+        }
+    });
+
+    std::vector<std::string> errors;
+    size_t collectionCount = 0;
+    size_t memberCount = 0;
+    for (size_t p = 0; p < prims.size(); ++p) {
+        errors.insert(errors.end(), primErrors[p].begin(), primErrors[p].end());
+        collectionCount += primCollections[p];
+        memberCount += primMembers[p];
+    }
+
+    if (collectionCount == 0) {
+        return {
+            "Validate Collections",
+            true,
+            "No collections found in the scene, which is acceptable."
+        };
+    }
+
+    if (!errors.empty()) {
+        std::string errorMsg = "Collection validation failed with the following issues:\n";
+        for (const auto& err : errors) {
+            errorMsg += "- " + err + "\n";
+        }
+        return {"Validate Collections", false, errorMsg};
+    }
+
+    return {"Validate Collections", true, "All " + std::to_string(collectionCount) + " collections resolve to " +
+                                          std::to_string(memberCount) + " member paths in total."};
+}
+
+/**
+ * @brief Validates the model hierarchy defined by prim kinds in a USD file.
+ *
+ * Walks only the model hierarchy: root prims and the children of groups and assemblies are
+ * visited, and traversal is pruned below components and below any prim that is not a group,
+ * so the walk never enters the geometry inside assets. Checks that:
+ * - Every authored kind is registered with the KindRegistry, and is not the abstract "model".
+ * - Components contain no models other than subcomponents (checked on their direct children).
+ * - Subcomponents only appear inside components.
+ * - Models are not cut off from the hierarchy by a parent that is not a group or assembly
+ *   (checked on the direct children of each pruned prim).
+ *
+ * @param stage The USD stage to validate.
+ * @return TestResult Containing:
+ *         - Test name ("Validate Kind Hierarchy").
+ *         - Success/failure status.
+ *         - Detailed validation results or errors.
+ */
+TestResult validateKindHierarchy(const pxr::UsdStageRefPtr& stage) {
+    if (!stage) {
+        return {"Validate Kind Hierarchy", false, "Invalid stage reference."};
+    }
+
+    auto kindOf = [](const pxr::UsdPrim& prim) {
+        pxr::TfToken kind;
+        pxr::UsdModelAPI(prim).GetKind(&kind);
+        return kind;
+    };
+    auto isModelKind = [](const pxr::TfToken& kind) {
+        return !kind.IsEmpty() && pxr::KindRegistry::IsA(kind, pxr::KindTokens->model);
+    };
+
+    std::vector<std::string> errors;
+    size_t visited = 0;
+    size_t assemblies = 0;
+    size_t groups = 0;
+    size_t components = 0;
+    bool foundAnyKind = false;
+
+    pxr::UsdPrimRange range = stage->Traverse();
+    for (auto it = range.begin(); it != range.end(); ++it) {
+        ++visited;
+        const pxr::UsdPrim prim = *it;
+        const pxr::TfToken kind = kindOf(prim);
+        const std::string path = prim.GetPath().GetString();
+        foundAnyKind |= !kind.IsEmpty();
+
+        if (!kind.IsEmpty() && !pxr::KindRegistry::HasKind(kind)) {
+            errors.push_back("Unknown kind '" + kind.GetString() + "' at " + path);
+            it.PruneChildren();
+            continue;
+        }
+        if (isModelKind(kind) && pxr::KindRegistry::IsA(kind, pxr::KindTokens->group)) {
+            pxr::KindRegistry::IsA(kind, pxr::KindTokens->assembly) ? ++assemblies : ++groups;
+            continue;  // Groups are the only prims whose children stay in the model hierarchy
+        }
+
+        if (isModelKind(kind) && pxr::KindRegistry::IsA(kind, pxr::KindTokens->component)) {
+            ++components;
+        } else if (!kind.IsEmpty() && pxr::KindRegistry::IsA(kind, pxr::KindTokens->subcomponent)) {
+            errors.push_back("Subcomponent " + path + " is not inside a component");
+        } else if (isModelKind(kind)) {
+            errors.push_back("Kind '" + kind.GetString() + "' at " + path +
+                             " is abstract; use component, group or assembly");
+        }
+
+        for (const auto& child : prim.GetChildren()) {
+            const pxr::TfToken childKind = kindOf(child);
+            foundAnyKind |= !childKind.IsEmpty();
+            if (!isModelKind(childKind)) {
+                continue;
+            }
+            if (pxr::KindRegistry::IsA(kind, pxr::KindTokens->component)) {
+                errors.push_back("Model " + child.GetPath().GetString() + " (" + childKind.GetString() +
+                                 ") is nested under component " + path);
+            } else {
+                errors.push_back("Model " + child.GetPath().GetString() + " (" + childKind.GetString() +
+                                 ") is under " + path + ", which is not a group, so it is cut off from the model hierarchy");
+            }
+        }
+        it.PruneChildren();
+    }
+
+    if (!foundAnyKind) {
+        return {
+            "Validate Kind Hierarchy",
+            true,
+            "No model kinds found in the model hierarchy, which is acceptable."
+        };
+    }
+
+    if (!errors.empty()) {
+        std::string errorMsg = "Kind hierarchy validation failed with the following issues:\n";
+        for (const auto& err : errors) {
+            errorMsg += "- " + err + "\n";
+        }
+        return {"Validate Kind Hierarchy", false, errorMsg};
+    }
+
+    return {"Validate Kind Hierarchy", true, "Model hierarchy is consistent: " + std::to_string(assemblies) +
+                                             " assemblies, " + std::to_string(groups) + " groups and " +
+                                             std::to_string(components) + " components in " +
+                                             std::to_string(visited) + " visited prims."};
+}
+
+/**
+ * @brief Checks one prim type and applied API schema list against the schema registry.
+ * @param typeName The prim's type name, empty for untyped prims.
+ * @param apiSchemas The API schemas authored on the prim, with instance names.
+ * @return std::vector<std::string> The problems found, empty if the combination is valid.
+ */
+std::vector<std::string> checkSchemaCombination(const pxr::TfToken& typeName, const pxr::TfTokenVector& apiSchemas) {
+    const pxr::UsdSchemaRegistry& registry = pxr::UsdSchemaRegistry::GetInstance();
+    std::vector<std::string> issues;
+
+    const pxr::TfType primType = pxr::UsdSchemaRegistry::GetTypeFromSchemaTypeName(typeName);
+    if (!typeName.IsEmpty()) {
+        if (primType.IsUnknown()) {
+            issues.push_back("Unknown prim type '" + typeName.GetString() + "'");
+        } else if (pxr::UsdSchemaRegistry::GetConcreteTypeFromSchemaTypeName(typeName).IsUnknown()) {
+            issues.push_back("Abstract prim type '" + typeName.GetString() + "' cannot be instantiated");
+        }
+    }
+
+    for (const auto& apiSchema : apiSchemas) {
+        const auto [schemaName, instanceName] = pxr::UsdSchemaRegistry::GetTypeNameAndInstance(apiSchema);
+        const pxr::TfType apiType = pxr::UsdSchemaRegistry::GetAPITypeFromSchemaTypeName(schemaName);
+        if (apiType.IsUnknown() || !registry.FindAppliedAPIPrimDefinition(schemaName)) {
+            issues.push_back("Unknown API schema '" + apiSchema.GetString() + "'");
+            continue;
+        }
+
+        const bool multipleApply = pxr::UsdSchemaRegistry::IsMultipleApplyAPISchema(apiType);
+        if (multipleApply && instanceName.IsEmpty()) {
+            issues.push_back("Multiple-apply API schema '" + apiSchema.GetString() + "' has no instance name");
+        } else if (!multipleApply && !instanceName.IsEmpty()) {
+            issues.push_back("Single-apply API schema '" + schemaName.GetString() + "' has an instance name '" +
+                             instanceName.GetString() + "'");
+        }
+
+        // An empty list means the schema can be applied to any prim type
+        const pxr::TfTokenVector& allowedTypes = registry.GetAPISchemaCanOnlyApplyToTypeNames(schemaName, instanceName);
+        if (allowedTypes.empty()) {
+            continue;
+        }
+        bool allowed = false;
+        std::string allowedList;
+        for (const auto& allowedType : allowedTypes) {
+            allowed |= !primType.IsUnknown() &&
+                       primType.IsA(pxr::UsdSchemaRegistry::GetTypeFromSchemaTypeName(allowedType));
+            allowedList += (allowedList.empty() ? "" : ", ") + allowedType.GetString();
+        }
+        if (!allowed) {
+            issues.push_back("API schema '" + apiSchema.GetString() + "' can only be applied to " + allowedList +
+                             ", not " + (typeName.IsEmpty() ? "untyped prims" : "'" + typeName.GetString() + "'"));
+        }
+    }
+
+    return issues;
+}
+
+/**
+ * @brief Validates prim types and applied API schemas against the schema registry.
+ *
+ * Prims are grouped by their unique combination of type name and authored API schemas, and the
+ * registry is queried once per combination rather than once per prim. Checks that:
+ * - Type names are registered concrete prim types.
+ * - Applied API schemas are registered, carry an instance name exactly when they are multiple-apply,
+ *   and are only applied to the prim types they allow.
+ * - Untyped prims either group children or get their type through a composition arc.
+ *
+ * @param stage The USD stage to validate.
+ * @return TestResult Containing:
+ *         - Test name ("Validate Schemas").
+ *         - Success/failure status.
+ *         - Detailed validation results or errors.
+ */
+TestResult validateSchemas(const pxr::UsdStageRefPtr& stage) {
+    if (!stage) {
+        return {"Validate Schemas", false, "Invalid stage reference."};
+    }
+
+    struct SchemaCombination {
+        pxr::TfToken typeName;
+        pxr::TfTokenVector apiSchemas;
+        std::vector<pxr::SdfPath> prims;
+    };
+    std::vector<SchemaCombination> combinations;  // In order of first use
+    std::map<std::pair<pxr::TfToken, pxr::TfTokenVector>, size_t> combinationIndices;
+    std::vector<std::string> errors;
+    size_t primCount = 0;
+
+    for (const auto& prim : stage->Traverse()) {
+        ++primCount;
+        const pxr::UsdPrimTypeInfo& typeInfo = prim.GetPrimTypeInfo();
+        auto key = std::make_pair(typeInfo.GetTypeName(), typeInfo.GetAppliedAPISchemas());
+        auto [it, inserted] = combinationIndices.emplace(key, combinations.size());
+        if (inserted) {
+            combinations.push_back({key.first, key.second, {}});
+        }
+        combinations[it->second].prims.push_back(prim.GetPath());
+
+        // An untyped leaf with no arcs to bring in a type describes nothing
+        if (key.first.IsEmpty() && prim.GetChildren().empty() && !prim.HasAuthoredReferences() &&
+            !prim.HasAuthoredPayloads() && !prim.HasAuthoredInherits() && !prim.HasAuthoredSpecializes()) {
+            errors.push_back("Untyped prim with no children or composition arcs: " + prim.GetPath().GetString());
+        }
+    }
+
+    if (primCount == 0) {
+        return {
+            "Validate Schemas",
+            true,
+            "No prims found in the scene, which is acceptable."
+        };
+    }
+
+    for (const auto& combination : combinations) {
+        const size_t others = combination.prims.size() - 1;
+        for (const auto& issue : checkSchemaCombination(combination.typeName, combination.apiSchemas)) {
+            errors.push_back(issue + " on " + combination.prims.front().GetString() +
+                             (others == 0 ? "" : " and " + std::to_string(others) + (others == 1 ? " other prim" : " other prims")));
+        }
+    }
+
+    if (!errors.empty()) {
+        std::string errorMsg = "Schema validation failed with the following issues:\n";
+        for (const auto& err : errors) {
+            errorMsg += "- " + err + "\n";
+        }
+        return {"Validate Schemas", false, errorMsg};
+    }
+
+    return {"Validate Schemas", true, "All " + std::to_string(primCount) + " prims use registered types and API schemas (" +
+                                      std::to_string(combinations.size()) + " distinct combinations checked)."};
+}
+
+/**
+ * @brief Validates the time samples of every animated attribute and reports where animation data lives.
+ *
+ * The bytes per sample come from the value type, and for arrays from the size of the earliest
+ * sample, which attributeValueBytes() reads in full; other samples are not read. String, token
+ * and asset values own variable-length text that their type size does not capture, so those
+ * attributes are counted but left out of the byte estimate. For each time-sampled attribute,
+ * checks that:
+ * - Every sample time is finite.
+ * - Every sample time lies within the stage's authored start and end time codes.
+ * - The sample count does not exceed TestConfig::maxTimeSamples (100000 by default, 0 means
+ *   unlimited).
+ * Prims are visited in parallel. The report lists the prims holding the most animated bytes.
+ *
+ * @param stage The USD stage to validate.
+ * @param config The configuration holding the sample count limit.
+ * @return TestResult Containing:
+ *         - Test name ("Validate Time Samples").
+ *         - Success/failure status.
+ *         - Animation cost report or detailed errors.
+ */
+TestResult validateTimeSamples(const pxr::UsdStageRefPtr& stage, const TestConfig& config) {
+    if (!stage) {
+        return {"Validate Time Samples", false, "Invalid stage reference."};
+    }
+
+    // Number of prims with the most animated bytes named in the report
+    static constexpr size_t kMaxListed = 5;
+
+    struct PrimAnimation {
+        size_t attributes = 0;
+        size_t unsized = 0;  // Attributes left out of the byte estimate
+        size_t samples = 0;
+        uint64_t bytes = 0;
+        std::vector<std::string> errors;
+    };
+
+    auto hasTextValues = [](const pxr::SdfValueTypeName& typeName) {
+        const pxr::SdfValueTypeName scalar = typeName.GetScalarType();
+        return scalar == pxr::SdfValueTypeNames->String || scalar == pxr::SdfValueTypeNames->Token ||
+               scalar == pxr::SdfValueTypeNames->Asset;
+    };
+
+    std::vector<pxr::UsdPrim> prims;
+    for (const auto& prim : stage->Traverse()) {
+        prims.push_back(prim);
+    }
+
+    const bool hasTimeRange = stage->HasAuthoredTimeCodeRange();
+    const double startTime = stage->GetStartTimeCode();
+    const double endTime = stage->GetEndTimeCode();
+    auto formatTime = [](double time) {
+        std::ostringstream stream;
+        stream << time;
+        return stream.str();
+    };
+    const std::string timeRange = "[" + formatTime(startTime) + ", " + formatTime(endTime) + "]";
+
+    std::vector<PrimAnimation> animations(prims.size());
+    pxr::WorkParallelForN(prims.size(), [&](size_t begin, size_t end) {
+        std::vector<double> times;
+        for (size_t i = begin; i < end; ++i) {
+            PrimAnimation& animation = animations[i];
+            for (const auto& attr : prims[i].GetAuthoredAttributes()) {
+                if (!attr.GetTimeSamples(&times) || times.empty()) {
+                    continue;
+                }
+                ++animation.attributes;
+                animation.samples += times.size();
+
+                const pxr::SdfValueTypeName typeName = attr.GetTypeName();
+                if (hasTextValues(typeName)) {
+                    ++animation.unsized;
+                } else {
+                    const size_t sampleBytes =
+                        typeName.IsArray() ? attributeValueBytes(attr) : typeName.GetType().GetSizeof();
+                    animation.bytes += static_cast<uint64_t>(sampleBytes) * times.size();
+                }
+
+                const std::string path = attr.GetPath().GetString();
+                size_t nonFinite = 0;
+                size_t outside = 0;
+                double firstOutside = 0.0;
+                for (double time : times) {
+                    if (!std::isfinite(time)) {
+                        ++nonFinite;
+                    } else if (hasTimeRange && (time < startTime || time > endTime)) {
+                        firstOutside = outside == 0 ? time : firstOutside;
+                        ++outside;
+                    }
+                }
+                if (nonFinite > 0) {
+                    animation.errors.push_back(std::to_string(nonFinite) + " non-finite sample times on " + path);
+                }
+                if (outside > 0) {
+                    animation.errors.push_back(std::to_string(outside) + " of " + std::to_string(times.size()) +
+                                               " samples on " + path + " fall outside the stage time range " +
+                                               timeRange + ", first at " + formatTime(firstOutside));
+                }
+                if (config.maxTimeSamples > 0 && times.size() > config.maxTimeSamples) {
+                    animation.errors.push_back(path + " has " + std::to_string(times.size()) +
+                                               " time samples, exceeding the limit of " +
+                                               std::to_string(config.maxTimeSamples));
+                }
+            }
+        }
+    });
+
+    PrimAnimation totals;
+    size_t animatedPrims = 0;
+    for (const auto& animation : animations) {
+        totals.attributes += animation.attributes;
+        totals.unsized += animation.unsized;
+        totals.samples += animation.samples;
+        totals.bytes += animation.bytes;
+        animatedPrims += animation.attributes > 0;
+    }
+
+    if (totals.attributes == 0) {
+        return {
+            "Validate Time Samples",
+            true,
+            "No time-sampled attributes found in the scene, which is acceptable."
+        };
+    }
+
+    std::vector<std::string> errors;
+    if (!hasTimeRange) {
+        errors.push_back("The stage has time-sampled attributes but no authored startTimeCode and endTimeCode");
+    }
+    for (const auto& animation : animations) {
+        errors.insert(errors.end(), animation.errors.begin(), animation.errors.end());
+    }
+
+    if (!errors.empty()) {
+        std::string errorMsg = "Time sample validation failed with the following issues:\n";
+        for (const auto& err : errors) {
+            errorMsg += "- " + err + "\n";
+        }
+        return {"Validate Time Samples", false, errorMsg};
+    }
+
+    std::vector<size_t> heaviest;
+    for (size_t i = 0; i < prims.size(); ++i) {
+        if (animations[i].attributes > 0) {
+            heaviest.push_back(i);
+        }
+    }
+    std::stable_sort(heaviest.begin(), heaviest.end(), [&animations](size_t a, size_t b) {
+        return animations[a].bytes > animations[b].bytes;
+    });
+
+    std::string message = std::to_string(totals.attributes) + " animated attributes on " +
+                          std::to_string(animatedPrims) + " prims hold an estimated " + formatBytes(totals.bytes) +
+                          " in " + std::to_string(totals.samples) + " time samples within " + timeRange +
+                          (totals.unsized > 0 ? ", not counting " + std::to_string(totals.unsized) +
+                                                    " string, token or asset attributes"
+                                              : std::string()) +
+                          ".\n";
+    for (size_t i = 0; i < heaviest.size() && i < kMaxListed; ++i) {
+        const PrimAnimation& animation = animations[heaviest[i]];
+        message += "- Prim " + prims[heaviest[i]].GetPath().GetString() + ": " + formatBytes(animation.bytes) +
+                   " in " + std::to_string(animation.attributes) + " attributes\n";
+    }
+
+    return {"Validate Time Samples", true, message};
+}
+
+/**
+ * @brief Compares two samples held as Element or VtArray<Element> byte for byte.
+ *
+ * Arrays are compared with one memcmp over their contiguous storage, skipped entirely when both
+ * samples share the same buffer.
+ *
+ * @param identical Receives whether the samples hold the same bytes.
+ * @return False if the samples hold neither Element nor VtArray<Element>.
+ */
+template <typename Element>
+bool compareSampleBytes(const pxr::VtValue& a, const pxr::VtValue& b, bool& identical) {
+    if (a.IsHolding<pxr::VtArray<Element>>() && b.IsHolding<pxr::VtArray<Element>>()) {
+        const auto& x = a.UncheckedGet<pxr::VtArray<Element>>();
+        const auto& y = b.UncheckedGet<pxr::VtArray<Element>>();
+        identical = x.size() == y.size() &&
+                    (x.IsIdentical(y) || std::memcmp(x.cdata(), y.cdata(), x.size() * sizeof(Element)) == 0);
+        return true;
+    }
+    if (a.IsHolding<Element>() && b.IsHolding<Element>()) {
+        identical = std::memcmp(&a.UncheckedGet<Element>(), &b.UncheckedGet<Element>(), sizeof(Element)) == 0;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Returns true if two time samples are bit-identical.
+ *
+ * Float, double, integer and vector types are compared as raw bytes; other types fall back to
+ * VtValue equality.
+ */
+bool identicalSamples(const pxr::VtValue& a, const pxr::VtValue& b) {
+    bool identical = false;
+    if (compareSampleBytes<float>(a, b, identical) ||
+        compareSampleBytes<double>(a, b, identical) ||
+        compareSampleBytes<int>(a, b, identical) ||
+        compareSampleBytes<pxr::GfVec2f>(a, b, identical) ||
+        compareSampleBytes<pxr::GfVec3f>(a, b, identical) ||
+        compareSampleBytes<pxr::GfVec3d>(a, b, identical) ||
+        compareSampleBytes<pxr::GfVec4f>(a, b, identical) ||
+        compareSampleBytes<pxr::GfQuatf>(a, b, identical) ||
+        compareSampleBytes<pxr::GfMatrix4d>(a, b, identical)) {
+        return identical;
+    }
+    return a == b;
+}
+
+/**
+ * @brief Detects time-sampled attributes whose samples could be collapsed without changing any value.
+ *
+ * Consecutive samples of each attribute with two or more samples are compared bit for bit, so
+ * removing the reported samples never changes a resolved value. An attribute is constant when
+ * all its samples are identical, and all but one can go. Otherwise each run of identical
+ * consecutive samples is piecewise constant: with held interpolation only the first sample of a
+ * run is needed, and with linear interpolation only its two ends, or one end for a run at the
+ * start or end of the animation. Attributes are compared in parallel, and the report gives the
+ * bytes that collapsing each attribute would save.
+ *
+ * @param stage The USD stage to validate.
+ * @return TestResult Containing:
+ *         - Test name ("Validate Redundant Time Samples").
+ *         - Success/failure status.
+ *         - Detailed validation results or errors.
+ */
+TestResult validateRedundantTimeSamples(const pxr::UsdStageRefPtr& stage) {
+    if (!stage) {
+        return {"Validate Redundant Time Samples", false, "Invalid stage reference."};
+    }
+
+    struct SampleRedundancy {
+        size_t samples = 0;
+        size_t redundant = 0;
+        uint64_t savedBytes = 0;
+    };
+
+    std::vector<pxr::UsdAttribute> attributes;
+    size_t animatedAttributes = 0;
+    for (const auto& prim : stage->Traverse()) {
+        for (const auto& attr : prim.GetAuthoredAttributes()) {
+            const size_t sampleCount = attr.GetNumTimeSamples();
+            animatedAttributes += sampleCount > 0;
+            if (sampleCount > 1) {
+                attributes.push_back(attr);
+            }
+        }
+    }
+
+    if (animatedAttributes == 0) {
+        return {
+            "Validate Redundant Time Samples",
+            true,
+            "No time-sampled attributes found in the scene, which is acceptable."
+        };
+    }
+
+    // Linear rules keep more samples, so they stay safe for types that are always held
+    const bool held = stage->GetInterpolationType() == pxr::UsdInterpolationTypeHeld;
+
+    std::vector<SampleRedundancy> redundancies(attributes.size());
+    pxr::WorkParallelForN(attributes.size(), [&](size_t begin, size_t end) {
+        std::vector<double> times;
+        for (size_t i = begin; i < end; ++i) {
+            if (!attributes[i].GetTimeSamples(&times) || times.size() < 2) {
+                continue;
+            }
+
+            SampleRedundancy& redundancy = redundancies[i];
+            redundancy.samples = times.size();
+            pxr::VtValue previous;
+            pxr::VtValue current;
+            attributes[i].Get(&previous, times.front());
+            const size_t elementBytes = attributes[i].GetTypeName().GetScalarType().GetType().GetSizeof();
+            const size_t sampleBytes = (previous.IsArrayValued() ? previous.GetArraySize() : 1) * elementBytes;
+
+            // Walk runs of identical consecutive samples
+            size_t runStart = 0;
+            for (size_t s = 1; s <= times.size(); ++s) {
+                bool extendsRun = false;
+                if (s < times.size()) {
+                    attributes[i].Get(&current, times[s]);
+                    extendsRun = identicalSamples(previous, current);
+                    previous.Swap(current);
+                }
+                if (extendsRun) {
+                    continue;
+                }
+
+                const size_t runLength = s - runStart;
+                const bool atEdge = runStart == 0 || s == times.size();
+                if (runLength > 1) {
+                    redundancy.redundant += held || atEdge ? runLength - 1 : runLength - 2;
+                }
+                runStart = s;
+            }
+            redundancy.savedBytes = static_cast<uint64_t>(redundancy.redundant) * sampleBytes;
+        }
+    });
+
+    std::vector<std::string> errors;
+    SampleRedundancy totals;
+    for (size_t i = 0; i < attributes.size(); ++i) {
+        const SampleRedundancy& redundancy = redundancies[i];
+        totals.samples += redundancy.samples;
+        totals.redundant += redundancy.redundant;
+        totals.savedBytes += redundancy.savedBytes;
+        if (redundancy.redundant == 0) {
+            continue;
+        }
+
+        const std::string path = attributes[i].GetPath().GetString();
+        if (redundancy.redundant + 1 == redundancy.samples) {
+            errors.push_back("Constant attribute " + path + ": " + std::to_string(redundancy.samples) +
+                             " identical samples (" + formatBytes(redundancy.savedBytes) + " redundant)");
+        } else {
+            errors.push_back("Piecewise constant attribute " + path + ": " + std::to_string(redundancy.redundant) +
+                             " of " + std::to_string(redundancy.samples) + " samples are redundant (" +
+                             formatBytes(redundancy.savedBytes) + ")");
+        }
+    }
+
+    if (!errors.empty()) {
+        std::string errorMsg = "Redundant time sample validation failed with the following issues:\n";
+        errorMsg += "- Collapsing redundant samples would save " + formatBytes(totals.savedBytes) + " in " +
+                    std::to_string(totals.redundant) + " of " + std::to_string(totals.samples) + " samples\n";
+        for (const auto& err : errors) {
+            errorMsg += "- " + err + "\n";
+        }
+        return {"Validate Redundant Time Samples", false, errorMsg};
+    }
+
+    return {"Validate Redundant Time Samples", true, "No redundant samples in " + std::to_string(animatedAttributes) +
+                                                     " animated attributes (" + std::to_string(totals.samples) +
+                                                     " samples compared)."};
+}
+
+/**
+ * @brief Validates that every asset path authored on the stage resolves.
+ *
+ * Works in three steps, so each distinct asset is resolved exactly once:
+ * - One parallel pass over the traversed prims collects the authored value of every asset and
+ *   asset array attribute (the strongest default and the strongest set of time samples) and the
+ *   asset paths and manifest of every value clip set, read raw from the layers that author
+ *   them. Each path is anchored to its authoring layer, giving the identifier the resolver sees.
+ * - Uses are deduplicated by identifier, keeping every attribute or clip set that uses each one.
+ * - Each unique identifier is resolved once, concurrently, under the stage's resolver context.
+ * Each unresolved asset is reported once with all of its users.
+ *
+ * UDIM tile set paths (containing "<UDIM>") name several files and are not checked.
+ *
+ * @param stage The USD stage to validate.
+ * @return TestResult Containing:
+ *         - Test name ("Validate Asset Paths").
+ *         - Success/failure status.
+ *         - Detailed validation results or errors.
+ */
+TestResult validateAssetPaths(const pxr::UsdStageRefPtr& stage) {
+    if (!stage) {
+        return {"Validate Asset Paths", false, "Invalid stage reference."};
+    }
+
+    struct AssetUse {
+        std::string owner;       // The attribute, or the prim and clip set
+        std::string assetPath;   // As authored
+        std::string identifier;  // Anchored to the layer that authors it
+    };
+
+    std::vector<pxr::UsdPrim> prims;
+    for (const auto& prim : stage->Traverse()) {
+        prims.push_back(prim);
+    }
+
+    std::vector<std::vector<AssetUse>> primUses(prims.size());
+    pxr::WorkParallelForN(prims.size(), [&](size_t begin, size_t end) {
+        // Anchoring may consult the resolver, whose context is bound per thread
+        const pxr::ArResolverContextBinder binder(stage->GetPathResolverContext());
+        for (size_t p = begin; p < end; ++p) {
+            std::vector<AssetUse>& uses = primUses[p];
+            auto addPath = [&uses](const std::string& owner, const pxr::SdfAssetPath& asset,
+                                   const pxr::SdfLayerHandle& layer) {
+                const std::string& assetPath = asset.GetAssetPath();
+                if (assetPath.empty() || assetPath.find("<UDIM>") != std::string::npos) {
+                    return;
+                }
+                uses.push_back({owner, assetPath, pxr::SdfComputeAssetPathRelativeToLayer(layer, assetPath)});
+            };
+            auto addValue = [&addPath](const std::string& owner, const pxr::VtValue& value,
+                                       const pxr::SdfLayerHandle& layer) {
+                if (value.IsHolding<pxr::SdfAssetPath>()) {
+                    addPath(owner, value.UncheckedGet<pxr::SdfAssetPath>(), layer);
+                } else if (value.IsHolding<pxr::VtArray<pxr::SdfAssetPath>>()) {
+                    for (const auto& asset : value.UncheckedGet<pxr::VtArray<pxr::SdfAssetPath>>()) {
+                        addPath(owner, asset, layer);
+                    }
+                }
+            };
+
+            for (const auto& attr : prims[p].GetAuthoredAttributes()) {
+                if (attr.GetTypeName().GetScalarType() != pxr::SdfValueTypeNames->Asset) {
+                    continue;
+                }
+                const std::string owner = attr.GetPath().GetString();
+                // The strongest spec with a default and the strongest spec with samples provide the values
+                bool foundDefault = false;
+                bool foundSamples = false;
+                for (const auto& spec : attr.GetPropertyStack()) {
+                    const pxr::SdfLayerHandle layer = spec->GetLayer();
+                    if (!foundDefault && spec->HasDefaultValue()) {
+                        foundDefault = true;
+                        addValue(owner, spec->GetDefaultValue(), layer);
+                    }
+                    if (!foundSamples) {
+                        const std::set<double> times = layer->ListTimeSamplesForPath(spec->GetPath());
+                        foundSamples = !times.empty();
+                        pxr::VtValue value;
+                        for (double time : times) {
+                            if (layer->QueryTimeSample(spec->GetPath(), time, &value)) {
+                                addValue(owner, value, layer);
+                            }
+                        }
+                    }
+                }
+            }
+
+            // Every key of the clips dictionary names a clip set, whether or not clipSets lists it.
+            // The strongest prim spec authoring a clip set's asset paths or manifest provides them.
+            std::set<std::pair<std::string, pxr::TfToken>> seenClipInfo;
+            for (const auto& spec : prims[p].GetPrimStack()) {
+                if (!spec->HasInfo(pxr::UsdTokens->clips)) {
+                    continue;
+                }
+                const pxr::VtValue clips = spec->GetInfo(pxr::UsdTokens->clips);
+                if (!clips.IsHolding<pxr::VtDictionary>()) {
+                    continue;
+                }
+                for (const auto& [clipSet, clipInfo] : clips.UncheckedGet<pxr::VtDictionary>()) {
+                    if (!clipInfo.IsHolding<pxr::VtDictionary>()) {
+                        continue;
+                    }
+                    const pxr::VtDictionary& info = clipInfo.UncheckedGet<pxr::VtDictionary>();
+                    const std::string owner = prims[p].GetPath().GetString() + " (clip set '" + clipSet + "')";
+                    for (const pxr::TfToken& key : {pxr::UsdClipsAPIInfoKeys->assetPaths,
+                                                    pxr::UsdClipsAPIInfoKeys->manifestAssetPath}) {
+                        auto found = info.find(key.GetString());
+                        if (found != info.end() && seenClipInfo.emplace(clipSet, key).second) {
+                            addValue(owner, found->second, spec->GetLayer());
+                        }
+                    }
+                }
+            }
+        }
+    });
+
+    // Unique identifiers in order of first use, with every owner of each
+    std::unordered_map<std::string, size_t> assetIndices;
+    std::vector<const AssetUse*> assets;  // First use of each unique asset
+    std::vector<std::vector<std::string>> assetOwners;
+    size_t useCount = 0;
+    for (const auto& uses : primUses) {
+        for (const auto& use : uses) {
+            ++useCount;
+            auto [found, inserted] = assetIndices.emplace(use.identifier, assets.size());
+            if (inserted) {
+                assets.push_back(&use);
+                assetOwners.emplace_back();
+            }
+            std::vector<std::string>& owners = assetOwners[found->second];
+            if (owners.empty() || owners.back() != use.owner) {
+                owners.push_back(use.owner);
+            }
+        }
+    }
+
+    if (useCount == 0) {
+        return {
+            "Validate Asset Paths",
+            true,
+            "No asset paths found in the scene, which is acceptable."
+        };
+    }
+
+    // Each unique asset is resolved once, concurrently
+    std::vector<uint8_t> resolved(assets.size(), 0);
+    pxr::WorkParallelForN(assets.size(), [&](size_t begin, size_t end) {
+        const pxr::ArResolverContextBinder binder(stage->GetPathResolverContext());
+        for (size_t i = begin; i < end; ++i) {
+            resolved[i] = static_cast<bool>(pxr::ArGetResolver().Resolve(assets[i]->identifier));
+        }
+    });
+
+    std::vector<std::string> errors;
+    for (size_t i = 0; i < assets.size(); ++i) {
+        if (resolved[i]) {
+            continue;
+        }
+        std::string owners;
+        for (const auto& owner : assetOwners[i]) {
+            owners += (owners.empty() ? "" : ", ") + owner;
+        }
+        errors.push_back("Unresolved asset " + assets[i]->assetPath + " used by " + owners);
+    }
+
+    if (!errors.empty()) {
+        std::string errorMsg = "Asset path validation failed with the following issues:\n";
+        for (const auto& err : errors) {
+            errorMsg += "- " + err + "\n";
+        }
+        return {"Validate Asset Paths", false, errorMsg};
+    }
+
+    return {"Validate Asset Paths", true, "All " + std::to_string(useCount) + " asset path values resolve to " +
+                                          std::to_string(assets.size()) + " unique assets."};
+}
+
+/**
+ * @brief Displays the usage instructions and available options for the USD test runner program.
+ */ 
+void displayHelp() {
+    std::cout << R"(
+Usage: usdTestRunner <path-to-usd-file> [options]
+
+Options:
+  -only-geometry    Run only geometry validation
+  -only-shaders     Run only shader validation
+  -only-layers      Run only layer structure validation
+  -only-variants    Run only variant validation
+  -only-normals     Run only normals validation
+  -skip-geometry    Skip geometry validation
+  -skip-shaders     Skip shader validation
+  -skip-layers      Skip layer structure validation
+  -skip-variants    Skip variant validation
+  -skip-normals     Skip normals validation
+  -only-statistics  Run only the scene statistics census
+  -skip-statistics  Skip the scene statistics census
+  -only-instancers  Run only point instancer validation
+  -skip-instancers  Skip point instancer validation
+  -only-curves      Run only basis curves and points validation
+  -skip-curves      Skip basis curves and points validation
+  -only-skinning    Run only skinning validation
+  -skip-skinning    Skip skinning validation
+  -only-memory      Run only the render memory estimate
+  -skip-memory      Skip the render memory estimate
+  -only-ranges      Run only attribute value range validation
+  -skip-ranges      Skip attribute value range validation
+  -only-hierarchy   Run only hierarchy depth and fan-out analysis
+  -skip-hierarchy   Skip hierarchy depth and fan-out analysis
+  -only-subsets     Run only geom subset validation
+  -skip-subsets     Skip geom subset validation
+  -only-meshpoints  Run only unreferenced and coincident mesh point detection
+  -skip-meshpoints  Skip unreferenced and coincident mesh point detection
+  -only-networks    Run only material network validation
+  -skip-networks    Skip material network validation
+  -only-bindings    Run only material binding validation
+  -skip-bindings    Skip material binding validation
+  -only-textures    Run only texture asset validation
+  -skip-textures    Skip texture asset validation
+  -only-definitions Run only shader definition validation against the registry
+  -skip-definitions Skip shader definition validation against the registry
+  -only-duplicates  Run only structurally identical material detection
+  -skip-duplicates  Skip structurally identical material detection
+  -only-orphans     Run only unused material and unreachable shader detection
+  -skip-orphans     Skip unused material and unreachable shader detection
+  -only-conntypes   Run only shader connection type compatibility validation
+  -skip-conntypes   Skip shader connection type compatibility validation
+  -only-texmem      Run only the texture memory estimate
+  -skip-texmem      Skip the texture memory estimate
+  -only-targets     Run only relationship target and connection existence validation
+  -skip-targets     Skip relationship target and connection existence validation
+  -only-collections Run only collection membership validation
+  -skip-collections Skip collection membership validation
+  -only-kinds       Run only model hierarchy (kind) validation
+  -skip-kinds       Skip model hierarchy (kind) validation
+  -only-schemas     Run only schema registry validation of prim types and API schemas
+  -skip-schemas     Skip schema registry validation of prim types and API schemas
+  -only-timesamples Run only time sample validation and animation cost report
+  -skip-timesamples Skip time sample validation and animation cost report
+  -only-redundant   Run only redundant time sample detection
+  -skip-redundant   Skip redundant time sample detection
+  -only-assets      Run only resolution of every asset path on the stage
+  -skip-assets      Skip resolution of every asset path on the stage
+  -max-prims <n>          Fail the census when the scene has more than n prims
+  -max-faces <n>          Fail the census when the scene has more than n mesh faces
+  -max-vertices <n>       Fail the census when the scene has more than n points
+  -max-primvar-bytes <n>  Fail the census when authored primvars exceed n bytes
+  -max-materials <n>      Fail the census when the scene has more than n materials
+  -max-memory-bytes <n>   Fail when the estimated render memory exceeds n bytes
+  -max-depth <n>          Fail when any prim is nested deeper than n levels
+  -max-children <n>       Fail when any prim has more than n direct children
+  -max-texture-bytes <n>  Fail when the estimated texture memory exceeds n bytes
+  -max-material-texture-bytes <n>
+                          Fail when any material's textures exceed n bytes
+  -max-model-texture-bytes <n>
+                          Fail when any model's textures, including its child models, exceed n bytes
+  -max-time-samples <n>   Fail when any attribute has more than n time samples
+                          (default 100000, 0 for no limit)
+  -range-rules <path>     Read the value range rules from path instead of the
+                          data/value_range_rules.txt next to the executable
+  -output <path>    Export results to specified file path
+  -help             Display this help message
+
+Note: 
+- 'only' flags and 'skip' flags are mutually exclusive
+- Multiple 'skip' flags can be combined
+- Only one 'only' flag can be used at a time
+)";
+}
+
+/**
+ * @brief Parses the numeric value given to a threshold option, exiting on malformed input.
+ * @param option The option the value belongs to, used in the error message.
+ * @param value The command line argument holding the value.
+ * @return The parsed threshold.
+ */
+size_t parseThreshold(const std::string& option, const char* value) {
+    char* end = nullptr;
+    unsigned long long parsed = std::strtoull(value, &end, 10);
+    if (end == value || *end != '\0' || value[0] == '-') {
+        std::cerr << "Error: " << option << " expects a non-negative integer, got '" << value << "'.\n";
+        displayHelp();
+        exit(1);
+    }
+    return static_cast<size_t>(parsed);
+}
+
+/**
+ * @brief Parses command line arguments to determine test configuration
+ * @param argc Number of arguments
+ * @param argv Array of arguments
+ * @return TestConfig object with enabled/disabled tests
+ */
+TestConfig parseArguments(int argc, char* argv[]) {
+    TestConfig config;
+    std::unordered_set<std::string> args;
+    
+    // Collect all arguments
+    for (int i = 1; i < argc; ++i) {
+        args.insert(argv[i]);
+        
+        // Check for output path
+        if (std::string(argv[i]) == "-output" && i + 1 < argc) {
+            config.outputPath = argv[i + 1];
+            ++i;  // Skip the next argument since it's the path
+            continue;
+        }
+
+        // Check for a value range rules file
+        if (std::string(argv[i]) == "-range-rules" && i + 1 < argc) {
+            config.rangeRulesPath = argv[i + 1];
+            ++i;  // Skip the next argument since it's the path
+            continue;
+        }
+
+        // Check for numeric thresholds
+        for (const auto& [option, member] : TestConfig::thresholdOptions()) {
+            if (argv[i] == option && i + 1 < argc) {
+                config.*member = parseThreshold(option, argv[i + 1]);
+                ++i;  // Skip the next argument since it's the value
+                break;
+            }
+        }
+    }
+
+    // Check for help flag first
+    if (args.count("-help")) {
+        displayHelp();
+        exit(0);
+    }
+
+    // Now check for USD file path
+    if (argc < 2 || argv[1][0] == '-') {  // First argument missing or is a flag
+        displayHelp();
+        exit(1);
+    }
+
+    // Count the 'only' and 'skip' flags that were supplied
+    int onlyFlags = 0;
+    int skipFlags = 0;
+    for (const auto& [id, flag] : TestConfig::testFlags()) {
+        onlyFlags += static_cast<int>(args.count("-only-" + id));
+        skipFlags += static_cast<int>(args.count("-skip-" + id));
+    }
+
+    if (onlyFlags > 1) {
+        std::cerr << "Error: Only one '-only' flag can be used at a time.\n";
+        displayHelp();
+        exit(1);
+    }
+
+    // Check for invalid combination of 'only' and 'skip' flags
+    if (onlyFlags > 0 && skipFlags > 0) {
+        std::cerr << "Error: Cannot combine '-only' and '-skip' flags.\n";
+        displayHelp();
+        exit(1);
+    }
+
+    // Handle 'only' flags, otherwise 'skip' flags
+    for (const auto& [id, flag] : TestConfig::testFlags()) {
+        if (onlyFlags > 0) {
+            config.*flag = args.count("-only-" + id) > 0;
+        } else if (args.count("-skip-" + id)) {
+            config.*flag = false;
+        }
+    }
+
+    if (!config.hasEnabledTests()) {
+        std::cerr << "Error: Cannot skip all tests. At least one test must run.\n";
+        displayHelp();
+        exit(1);
+    }
+
+    return config;
+}
+
+/**
+ * @brief Displays the program introduction with ASCII art and a description of the tool.
+ */
+void displayIntro() {
+    std::cout << R"(
+   ___      ___       ________      _________
+  |   |    |   |    /   ___   \    |         \
+  |   |    |   |   |   /   \___|   |    ___   \
+  |   |    |   |   |   \______     |   |   |   |
+  |   |    |   |    \______   \    |   |   |   |
+  |   |____|   |    ___    \   \   |   |___|   |
+  |            |   |   \___/   |   |          /
+   \__________/     \_________/    |_________/
+    )" << '\n';
+
+    std::cout << "\nWelcome to the USD Test Runner!\n";
+    std::cout << "This program validates USD files for geometry, shaders, and layer structure.\n";
+    std::cout << "Provide a USD file as input to test its compliance with basic asset standards.\n";
+    std::cout << "\nFor further details, view the README file located in the root directory.\n";
+    std::cout << "------------------------------------------------------------\n\n";
+}
+
+/**
+ * @brief Entry point for the program.
+ *
+ * @param argc The number of command-line arguments.
+ * @param argv Array of command-line arguments.
+ * @return Exit status of the program.
+ */
+int main(int argc, char* argv[]) {
+    // Check for help flag before anything else
+    if (argc > 1 && std::string(argv[1]) == "-help") {
+        displayHelp();
+        return 0;
+    }
+
+    // Missing arguments case
+    if (argc < 2) {
+        displayHelp();
+        return 1;
+    }
+
+    const std::string usdFilePath = argv[1];
+    TestRunner runner(usdFilePath);
+
+    // Parse command line arguments first so configurable tests can see the thresholds
+    TestConfig config = parseArguments(argc, argv);
+
+    // Collection membership queries shared by the tests that resolve collections
+    CollectionMembershipCache collections;
+
+    // Model hierarchy shared by the tests that walk every prim, so the stage is traversed once
+    ModelHierarchyCache hierarchies;
+
+    // Array sizes shared by the census and the memory estimate, so each array is read once
+    PrimSizeCache sizes;
+
+    // Material networks shared by the shading tests, so each material is visited once
+    MaterialNetworkCache networks;
+
+    // Add tests with their identifiers
+    runner.addTest("geometry", validateGeometry);
+    runner.addTest("shaders", validateShaders);
+    runner.addTest("layers", validateLayerStructure);
+    runner.addTest("variants", validateVariants);
+    runner.addTest("normals", validateNormals);
+    runner.addTest("statistics", [&config, &hierarchies, &sizes](const pxr::UsdStageRefPtr& stage) {
+        return validateSceneStatistics(stage, config, hierarchies, sizes);
+    });
+    runner.addTest("instancers", validatePointInstancers);
+    runner.addTest("curves", validateCurvesAndPoints);
+    runner.addTest("skinning", validateSkinning);
+    runner.addTest("memory", [&config, &hierarchies, &sizes](const pxr::UsdStageRefPtr& stage) {
+        return validateRenderMemory(stage, config, hierarchies, sizes);
+    });
+    runner.addTest("ranges", [&config](const pxr::UsdStageRefPtr& stage) {
+        return validateValueRanges(stage, config);
+    });
+    runner.addTest("hierarchy", [&config, &hierarchies](const pxr::UsdStageRefPtr& stage) {
+        return validateHierarchy(stage, config, hierarchies);
+    });
+    runner.addTest("subsets", validateGeomSubsets);
+    runner.addTest("meshpoints", validateMeshPoints);
+    runner.addTest("networks", [&networks](const pxr::UsdStageRefPtr& stage) {
+        return validateMaterialNetworks(stage, networks);
+    });
+    runner.addTest("bindings", [&collections](const pxr::UsdStageRefPtr& stage) {
+        return validateMaterialBindings(stage, collections);
+    });
+    runner.addTest("textures", validateTextures);
+    runner.addTest("definitions", validateShaderDefinitions);
+    runner.addTest("duplicates", [&networks](const pxr::UsdStageRefPtr& stage) {
+        return validateMaterialDuplicates(stage, networks);
+    });
+    runner.addTest("orphans", [&networks](const pxr::UsdStageRefPtr& stage) {
+        return validateOrphanedShading(stage, networks);
+    });
+    runner.addTest("conntypes", [&networks](const pxr::UsdStageRefPtr& stage) {
+        return validateConnectionTypes(stage, networks);
+    });
+    runner.addTest("texmem", [&config, &hierarchies](const pxr::UsdStageRefPtr& stage) {
+        return validateTextureMemory(stage, config, hierarchies);
+    });
+    runner.addTest("targets", validateTargets);
+    runner.addTest("collections", [&collections](const pxr::UsdStageRefPtr& stage) {
+        return validateCollections(stage, collections);
+    });
+    runner.addTest("kinds", validateKindHierarchy);
+    runner.addTest("schemas", validateSchemas);
+    runner.addTest("timesamples", [&config](const pxr::UsdStageRefPtr& stage) {
+        return validateTimeSamples(stage, config);
+    });
+    runner.addTest("redundant", validateRedundantTimeSamples);
+    runner.addTest("assets", validateAssetPaths);
+
+    // Run tests
     runner.runTests(config);
 
     return 0;